@@ -38,6 +38,33 @@ template <class Range> bool islinspace(const Range &range) {
   }
 }
 
+/// Return true if `range` is strictly increasing with a constant ratio of
+/// neighboring elements, such as the output of `numpy.geomspace`.
+template <class Range> bool islogspace(const Range &range) {
+  using T = typename Range::value_type;
+  if constexpr (!std::is_floating_point_v<T>) {
+    return false;
+  } else {
+    if (scipp::size(range) < 2)
+      return false;
+    if (!(range.front() > 0) || range.back() <= range.front())
+      return false;
+    using std::log;
+    const auto log_front = log(static_cast<double>(range.front()));
+    const auto log_back = log(static_cast<double>(range.back()));
+    const auto delta = (log_back - log_front) / (scipp::size(range) - 1);
+    constexpr int32_t ulp = 4;
+    const double epsilon = std::numeric_limits<T>::epsilon() *
+                           (std::abs(log_front) + std::abs(log_back) + 1) * ulp;
+    return std::adjacent_find(range.begin(), range.end(),
+                              [epsilon, delta](const auto &a, const auto &b) {
+                                return !(std::abs(log(static_cast<double>(b)) -
+                                                  log(static_cast<double>(a)) -
+                                                  delta) <= epsilon);
+                              }) == range.end();
+  }
+}
+
 // Division like Python's __truediv__
 template <class T, class U> auto true_divide(const T &a, const U &b) {
   if constexpr (std::is_integral_v<T> && std::is_integral_v<U>)
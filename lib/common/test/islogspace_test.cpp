@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "scipp/common/numeric.h"
+
+using scipp::numeric::islogspace;
+
+TEST(IsLogspaceTest, empty) {
+  ASSERT_FALSE(islogspace(std::vector<double>({})));
+}
+
+TEST(IsLogspaceTest, size_1) {
+  ASSERT_FALSE(islogspace(std::vector<double>({1.0})));
+}
+
+TEST(IsLogspaceTest, size_2) {
+  ASSERT_TRUE(islogspace(std::vector<double>({1.0, 3.0})));
+}
+
+TEST(IsLogspaceTest, integer) {
+  ASSERT_FALSE(islogspace(std::vector<int64_t>({1, 2, 4, 8})));
+}
+
+TEST(IsLogspaceTest, powers_of_two) {
+  ASSERT_TRUE(islogspace(std::vector<double>({1.0, 2.0, 4.0, 8.0})));
+  ASSERT_TRUE(islogspace(std::vector<float>({0.25f, 0.5f, 1.0f, 2.0f})));
+}
+
+TEST(IsLogspaceTest, linspace) {
+  ASSERT_FALSE(islogspace(std::vector<double>({1.0, 2.0, 3.0, 4.0})));
+}
+
+TEST(IsLogspaceTest, decreasing) {
+  ASSERT_FALSE(islogspace(std::vector<double>({8.0, 4.0, 2.0, 1.0})));
+}
+
+TEST(IsLogspaceTest, not_positive) {
+  ASSERT_FALSE(islogspace(std::vector<double>({0.0, 1.0, 2.0})));
+  ASSERT_FALSE(islogspace(std::vector<double>({-4.0, -2.0, -1.0})));
+}
+
+TEST(IsLogspaceTest, nan) {
+  ASSERT_FALSE(islogspace(std::vector<double>({1.0, NAN, 4.0})));
+}
+
+TEST(IsLogspaceTest, geomspace) {
+  std::vector<double> range(1000);
+  for (size_t i = 0; i < range.size(); ++i)
+    range[i] = std::pow(10.0, -3.0 + 8.0 * static_cast<double>(i) / 999.0);
+  ASSERT_TRUE(islogspace(range));
+  range[500] *= 1.0 + 1e-9;
+  ASSERT_FALSE(islogspace(range));
+}
@@ -10,6 +10,7 @@
 #include <cassert>
 
 #include "scipp/core/memory_pool.h"
+#include "scipp/core/memory_usage.h"
 
 namespace scipp::core {
 
@@ -21,9 +22,7 @@ enum class Alignment : size_t {
 
 namespace detail {
 void *allocate_aligned_memory(size_t align, size_t size);
-void deallocate_aligned_memory(void *ptr) noexcept;
-
-//#define USE_POOL
+void deallocate_aligned_memory(void *ptr, size_t size) noexcept;
 
 template <typename T> constexpr bool is_power_of_two(T v) {
   return v && ((v & (v - 1)) == 0);
@@ -32,33 +31,20 @@ template <typename T> constexpr bool is_power_of_two(T v) {
 inline void *allocate_aligned_memory(size_t align, size_t size) {
   assert(align >= sizeof(void *));
   assert(is_power_of_two(align));
+  assert(align <= MemoryPool::alignment);
 
   if (size == 0) {
     return nullptr;
   }
-
-#ifdef USE_POOL
-  return instance().allocate(size);
-#else
-  void *ptr = nullptr;
-  int rc = posix_memalign(&ptr, align, size);
-  if (rc != 0) {
-    return nullptr;
-  }
+  auto *ptr = instance().allocate(size);
+  record_allocation(static_cast<scipp::index>(size));
   return ptr;
-#endif
 }
 
-inline void deallocate_aligned_memory(void *ptr) noexcept {
-#ifdef USE_POOL
-  return instance().deallocate(ptr);
-#else
-#ifdef _WIN32
-  return _aligned_free(ptr);
-#else
-  return free(ptr);
-#endif
-#endif
+inline void deallocate_aligned_memory(void *ptr, size_t size) noexcept {
+  if (ptr)
+    record_deallocation(static_cast<scipp::index>(size));
+  instance().deallocate(ptr);
 }
 } // namespace detail
 
@@ -118,8 +104,8 @@ public:
     return reinterpret_cast<pointer>(ptr);
   }
 
-  void deallocate(pointer p, size_type) noexcept {
-    return detail::deallocate_aligned_memory(p);
+  void deallocate(pointer p, size_type n) noexcept {
+    return detail::deallocate_aligned_memory(p, n * sizeof(T));
   }
 
   template <class U, class... Args> void construct(U *p, Args &&... args) {
@@ -170,8 +156,8 @@ public:
     return reinterpret_cast<pointer>(ptr);
   }
 
-  void deallocate(pointer p, size_type) noexcept {
-    return detail::deallocate_aligned_memory(p);
+  void deallocate(pointer p, size_type n) noexcept {
+    return detail::deallocate_aligned_memory(p, n * sizeof(T));
   }
 
   template <class U, class... Args> void construct(U *p, Args &&... args) {
@@ -62,36 +62,22 @@ template <> inline constexpr DType dtype<std::span<time_point>>{206};
 // std containers start at 300
 template <> inline constexpr DType dtype<std::pair<int32_t, int32_t>>{300};
 template <> inline constexpr DType dtype<std::pair<int64_t, int64_t>>{301};
-template <>
-inline constexpr DType dtype<std::unordered_map<double, int64_t>>{302};
-template <>
-inline constexpr DType dtype<std::unordered_map<double, int32_t>>{303};
-template <>
-inline constexpr DType dtype<std::unordered_map<float, int64_t>>{304};
-template <>
-inline constexpr DType dtype<std::unordered_map<float, int32_t>>{305};
-template <>
-inline constexpr DType dtype<std::unordered_map<int64_t, int64_t>>{306};
-template <>
-inline constexpr DType dtype<std::unordered_map<int64_t, int32_t>>{307};
-template <>
-inline constexpr DType dtype<std::unordered_map<int32_t, int64_t>>{308};
-template <>
-inline constexpr DType dtype<std::unordered_map<int32_t, int32_t>>{309};
-template <>
-inline constexpr DType dtype<std::unordered_map<bool, int64_t>>{310};
-template <>
-inline constexpr DType dtype<std::unordered_map<bool, int32_t>>{311};
-template <>
-inline constexpr DType dtype<std::unordered_map<std::string, int64_t>>{312};
-template <>
-inline constexpr DType dtype<std::unordered_map<std::string, int32_t>>{313};
-template <>
-inline constexpr DType dtype<std::unordered_map<core::time_point, int64_t>>{
-    314};
-template <>
-inline constexpr DType dtype<std::unordered_map<core::time_point, int32_t>>{
-    315};
+// helpers of `bin` for mapping group labels to indices
+template <class T, class Index> class GroupMap;
+template <> inline constexpr DType dtype<GroupMap<double, int64_t>>{302};
+template <> inline constexpr DType dtype<GroupMap<double, int32_t>>{303};
+template <> inline constexpr DType dtype<GroupMap<float, int64_t>>{304};
+template <> inline constexpr DType dtype<GroupMap<float, int32_t>>{305};
+template <> inline constexpr DType dtype<GroupMap<int64_t, int64_t>>{306};
+template <> inline constexpr DType dtype<GroupMap<int64_t, int32_t>>{307};
+template <> inline constexpr DType dtype<GroupMap<int32_t, int64_t>>{308};
+template <> inline constexpr DType dtype<GroupMap<int32_t, int32_t>>{309};
+template <> inline constexpr DType dtype<GroupMap<bool, int64_t>>{310};
+template <> inline constexpr DType dtype<GroupMap<bool, int32_t>>{311};
+template <> inline constexpr DType dtype<GroupMap<std::string, int64_t>>{312};
+template <> inline constexpr DType dtype<GroupMap<std::string, int32_t>>{313};
+template <> inline constexpr DType dtype<GroupMap<time_point, int64_t>>{314};
+template <> inline constexpr DType dtype<GroupMap<time_point, int32_t>>{315};
 // scipp::variable types start at 1000
 // scipp::dataset types start at 2000
 // scipp::python types start at 3000
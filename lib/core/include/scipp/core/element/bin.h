@@ -12,6 +12,7 @@
 #include "scipp/core/eigen.h"
 #include "scipp/core/element/arg_list.h"
 #include "scipp/core/element/util.h"
+#include "scipp/core/group_map.h"
 #include "scipp/core/histogram.h"
 #include "scipp/core/subbin_sizes.h"
 #include "scipp/core/time_point.h"
@@ -84,20 +85,12 @@ static constexpr auto groups_to_map = overloaded{
     transform_flags::expect_no_variance_arg<0>,
     [](const units::Unit &u) { return u; },
     [](const auto &groups) {
-      std::unordered_map<typename std::decay_t<decltype(groups)>::value_type,
-                         Index>
-          index;
-      scipp::index current = 0;
-      for (const auto &item : groups)
-        index[item] = current++;
-      if (scipp::size(groups) != scipp::size(index))
-        throw std::runtime_error("Duplicate group labels.");
-      return index;
+      return GroupMap<typename std::decay_t<decltype(groups)>::value_type,
+                      Index>(groups);
     }};
 
 template <class Index, class T>
-using update_indices_by_grouping_arg =
-    std::tuple<Index, T, std::unordered_map<T, Index>>;
+using update_indices_by_grouping_arg = std::tuple<Index, T, GroupMap<T, Index>>;
 
 static constexpr auto update_indices_by_grouping = overloaded{
     element::arg_list<update_indices_by_grouping_arg<int64_t, double>,
@@ -122,9 +115,9 @@ static constexpr auto update_indices_by_grouping = overloaded{
     [](auto &index, const auto &x, const auto &groups) {
       if (index == -1)
         return;
-      const auto it = groups.find(x);
+      const auto group = groups.find(x);
       index *= scipp::size(groups);
-      index = (it == groups.end()) ? -1 : (index + it->second);
+      index = (group == -1) ? -1 : (index + group);
     }};
 
 static constexpr auto update_indices_from_existing = overloaded{
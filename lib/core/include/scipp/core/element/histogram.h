@@ -32,49 +32,24 @@ namespace histogram_detail {
 template <class Out, class Coord, class Weight, class Edge>
 using args = std::tuple<std::span<Out>, std::span<const Coord>,
                         std::span<const Weight>, std::span<const Edge>>;
-}
 
-static constexpr auto histogram = overloaded{
-    element::arg_list<
-        histogram_detail::args<float, double, float, double>,
-        histogram_detail::args<float, float, float, double>,
-        histogram_detail::args<float, int64_t, float, double>,
-        histogram_detail::args<float, int32_t, float, double>,
-        histogram_detail::args<double, double, double, double>,
-        histogram_detail::args<double, float, double, double>,
-        histogram_detail::args<double, float, double, float>,
-        histogram_detail::args<double, double, float, double>,
-        histogram_detail::args<double, int64_t, double, int64_t>,
-        histogram_detail::args<double, int32_t, double, int64_t>,
-        histogram_detail::args<double, int64_t, double, int32_t>,
-        histogram_detail::args<double, int32_t, double, int32_t>,
-        histogram_detail::args<double, time_point, double, time_point>,
-        histogram_detail::args<double, time_point, float, time_point>,
-        histogram_detail::args<float, time_point, double, time_point>,
-        histogram_detail::args<float, time_point, float, time_point>>,
-    [](const auto &data, const auto &events, const auto &weights,
-       const auto &edges) {
-      zero(data);
-      // Special implementation for linear bins. Gives a 1x to 20x speedup
-      // for few and many events per histogram, respectively.
-      if (scipp::numeric::islinspace(edges)) {
-        const auto [offset, nbin, scale] = core::linear_edge_params(edges);
-        for (scipp::index i = 0; i < scipp::size(events); ++i) {
-          const auto x = events[i];
-          const double bin = (x - offset) * scale;
-          if (bin >= 0.0 && bin < nbin)
-            iadd(data, static_cast<scipp::index>(bin), weights, i);
-        }
-      } else {
-        core::expect::histogram::sorted_edges(edges);
-        for (scipp::index i = 0; i < scipp::size(events); ++i) {
-          const auto x = events[i];
-          auto it = std::upper_bound(edges.begin(), edges.end(), x);
-          if (it != edges.end() && it != edges.begin())
-            iadd(data, --it - edges.begin(), weights, i);
-        }
-      }
-    },
+constexpr auto common = overloaded{
+    element::arg_list<args<float, double, float, double>,
+                      args<float, float, float, double>,
+                      args<float, int64_t, float, double>,
+                      args<float, int32_t, float, double>,
+                      args<double, double, double, double>,
+                      args<double, float, double, double>,
+                      args<double, float, double, float>,
+                      args<double, double, float, double>,
+                      args<double, int64_t, double, int64_t>,
+                      args<double, int32_t, double, int64_t>,
+                      args<double, int64_t, double, int32_t>,
+                      args<double, int32_t, double, int32_t>,
+                      args<double, time_point, double, time_point>,
+                      args<double, time_point, float, time_point>,
+                      args<float, time_point, double, time_point>,
+                      args<float, time_point, float, time_point>>,
     [](const units::Unit &events_unit, const units::Unit &weights_unit,
        const units::Unit &edge_unit) {
       if (events_unit != edge_unit)
@@ -86,4 +61,92 @@ static constexpr auto histogram = overloaded{
     transform_flags::expect_no_variance_arg<1>,
     transform_flags::expect_no_variance_arg<3>};
 
+constexpr auto linspace = [](const auto &data, const auto &events,
+                             const auto &weights, const auto &edges) {
+  const auto [offset, nbin, scale] = core::linear_edge_params(edges);
+  for (scipp::index i = 0; i < scipp::size(events); ++i) {
+    const auto x = events[i];
+    const double bin = (x - offset) * scale;
+    if (bin >= 0.0 && bin < nbin)
+      iadd(data, static_cast<scipp::index>(bin), weights, i);
+  }
+};
+
+constexpr auto logspace = [](const auto &data, const auto &events,
+                             const auto &weights, const auto &edges) {
+  const auto [offset, nbin, scale] = core::log_edge_params(edges);
+  for (scipp::index i = 0; i < scipp::size(events); ++i) {
+    const auto bin = core::log_edge_bin(edges, offset, nbin, scale, events[i]);
+    if (bin >= 0)
+      iadd(data, bin, weights, i);
+  }
+};
+
+/// Minimum ratio of events and edges for using `SortedEdgeLookup`.
+constexpr scipp::index min_events_per_edge_for_lookup = 4;
+
+constexpr auto sorted_edges = [](const auto &data, const auto &events,
+                                 const auto &weights, const auto &edges) {
+  using Edge = typename std::decay_t<decltype(edges)>::value_type;
+  if constexpr (std::is_arithmetic_v<Edge>) {
+    if (scipp::size(events) >=
+        min_events_per_edge_for_lookup * scipp::size(edges)) {
+      const core::SortedEdgeLookup lookup(edges);
+      for (scipp::index i = 0; i < scipp::size(events); ++i)
+        if (const auto bin = lookup(events[i]); bin >= 0)
+          iadd(data, bin, weights, i);
+      return;
+    }
+  }
+  for (scipp::index i = 0; i < scipp::size(events); ++i) {
+    const auto x = events[i];
+    auto it = std::upper_bound(edges.begin(), edges.end(), x);
+    if (it != edges.end() && it != edges.begin())
+      iadd(data, --it - edges.begin(), weights, i);
+  }
+};
+} // namespace histogram_detail
+
+static constexpr auto histogram = overloaded{
+    histogram_detail::common, [](const auto &data, const auto &events,
+                                 const auto &weights, const auto &edges) {
+      zero(data);
+      // Special implementation for linear bins. Gives a 1x to 20x speedup
+      // for few and many events per histogram, respectively.
+      if (scipp::numeric::islinspace(edges)) {
+        histogram_detail::linspace(data, events, weights, edges);
+      } else {
+        core::expect::histogram::sorted_edges(edges);
+        histogram_detail::sorted_edges(data, events, weights, edges);
+      }
+    }};
+
+/// Histogram with edges known to be linearly spaced, see `histogram`.
+static constexpr auto histogram_linspace = overloaded{
+    histogram_detail::common, [](const auto &data, const auto &events,
+                                 const auto &weights, const auto &edges) {
+      zero(data);
+      histogram_detail::linspace(data, events, weights, edges);
+    }};
+
+/// Histogram with edges known to be logarithmically spaced, see `histogram`.
+static constexpr auto histogram_logspace = overloaded{
+    histogram_detail::common, [](const auto &data, const auto &events,
+                                 const auto &weights, const auto &edges) {
+      zero(data);
+      using Edge = typename std::decay_t<decltype(edges)>::value_type;
+      if constexpr (std::is_floating_point_v<Edge>)
+        histogram_detail::logspace(data, events, weights, edges);
+      else
+        histogram_detail::sorted_edges(data, events, weights, edges);
+    }};
+
+/// Histogram with edges known to be sorted, see `histogram`.
+static constexpr auto histogram_sorted_edges = overloaded{
+    histogram_detail::common, [](const auto &data, const auto &events,
+                                 const auto &weights, const auto &edges) {
+      zero(data);
+      histogram_detail::sorted_edges(data, events, weights, edges);
+    }};
+
 } // namespace scipp::core::element
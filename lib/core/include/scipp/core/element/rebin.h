@@ -4,7 +4,12 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <functional>
+#include <limits>
+#include <span>
+#include <tuple>
 #include <type_traits>
 
 #include "scipp/common/numeric.h"
@@ -17,56 +22,104 @@
 
 namespace scipp::core::element {
 
-template <class Less>
-static constexpr auto rebin = overloaded{
-    [](const auto &data_new, const auto &xnew, const auto &data_old,
-       const auto &xold) {
-      using T = decltype(xold[0] + (xold[0] - xnew[0]));
-      // Note: using const rather than constexpr here is required to
-      // avoid an internal compiler error on Windows/MSVC
-      const Less less;
-      zero(data_new);
-      const auto oldSize = scipp::size(xold) - 1;
-      const auto newSize = scipp::size(xnew) - 1;
-      scipp::index iold = 0;
-      scipp::index inew = 0;
-      while ((iold < oldSize) && (inew < newSize)) {
-        const T xo_low = xold[iold];
-        const T xo_high = xold[iold + 1];
-        const T xn_low = xnew[inew];
-        const T xn_high = xnew[inew + 1];
-        if (!less(xo_low, xn_high))
-          inew++; // old and new bins do not overlap
-        else if (!less(xn_low, xo_high))
-          iold++; // old and new bins do not overlap
-        else {
-          // delta is the overlap of the bins on the x axis
-          using std::min;
-          using std::max;
-          const auto delta =
-              std::abs(min(xn_high, xo_high, less) - max(xn_low, xo_low, less));
-          const auto owidth = std::abs(xo_high - xo_low);
-          const auto scale = delta / owidth;
-          if constexpr (is_ValueAndVariance_v<
-                            std::decay_t<decltype(data_old)>>) {
-            data_new.value[inew] += data_old.value[iold] * scale;
-            data_new.variance[inew] += data_old.variance[iold] * scale;
-          } else if constexpr (std::is_same_v<typename std::decay_t<decltype(
-                                                  data_new)>::value_type,
-                                              bool>) {
-            static_cast<void>(scale);
-            data_new[inew] = data_new[inew] || data_old[iold];
-          } else {
-            data_new[inew] += data_old[iold] * scale;
-          }
-          if (less(xo_high, xn_high)) {
-            iold++;
-          } else {
-            inew++;
-          }
-        }
+namespace rebin_detail {
+/// Call `f(inew, iold, delta, owidth)` for all pairs of overlapping new and old
+/// bins.
+///
+/// `delta` is the width of the overlap and `owidth` the width of the old bin.
+/// Pairs are visited in order of increasing `inew`, and of increasing `iold`
+/// for given `inew`.
+template <class Less, class NewEdges, class OldEdges, class F>
+void for_each_overlap(const NewEdges &xnew, const OldEdges &xold, F &&f) {
+  using T = decltype(xold[0] + (xold[0] - xnew[0]));
+  // Note: using const rather than constexpr here is required to
+  // avoid an internal compiler error on Windows/MSVC
+  const Less less;
+  const auto oldSize = scipp::size(xold) - 1;
+  const auto newSize = scipp::size(xnew) - 1;
+  scipp::index iold = 0;
+  scipp::index inew = 0;
+  while ((iold < oldSize) && (inew < newSize)) {
+    const T xo_low = xold[iold];
+    const T xo_high = xold[iold + 1];
+    const T xn_low = xnew[inew];
+    const T xn_high = xnew[inew + 1];
+    if (!less(xo_low, xn_high))
+      inew++; // old and new bins do not overlap
+    else if (!less(xn_low, xo_high))
+      iold++; // old and new bins do not overlap
+    else {
+      // delta is the overlap of the bins on the x axis
+      using std::min;
+      using std::max;
+      const auto delta =
+          std::abs(min(xn_high, xo_high, less) - max(xn_low, xo_low, less));
+      const auto owidth = std::abs(xo_high - xo_low);
+      f(inew, iold, delta, owidth);
+      if (less(xo_high, xn_high)) {
+        iold++;
+      } else {
+        inew++;
       }
-    },
+    }
+  }
+}
+
+/// Return the width of the part of new bin `inew` covered by the old bins.
+template <class Less, class NewEdges, class OldEdges>
+auto covered_width(const NewEdges &xnew, const OldEdges &xold,
+                   const scipp::index inew) {
+  using T = decltype(xold[0] + (xold[0] - xnew[0]));
+  const Less less;
+  using std::min;
+  using std::max;
+  const T low = max<T>(xnew[inew], xold.front(), less);
+  const T high = min<T>(xnew[inew + 1], xold.back(), less);
+  return less(low, high) ? std::abs(high - low) : T{0};
+}
+
+/// Set every new bin to the old value selected by `select` among all old bins
+/// overlapping it, or to `init` if there are none.
+///
+/// Variances are those of the selected values.
+template <class Less, class NewData, class NewEdges, class OldData,
+          class OldEdges, class Select, class T>
+void select_overlapping(const NewData &data_new, const NewEdges &xnew,
+                        const OldData &data_old, const OldEdges &xold,
+                        const Select select, const T init) {
+  if constexpr (is_ValueAndVariance_v<NewData>) {
+    std::fill(data_new.value.begin(), data_new.value.end(), init);
+    zero(data_new.variance);
+  } else {
+    std::fill(data_new.begin(), data_new.end(), init);
+  }
+  for_each_overlap<Less>(xnew, xold,
+                         [&](const scipp::index inew, const scipp::index iold,
+                             const auto, const auto) {
+                           if constexpr (is_ValueAndVariance_v<OldData>) {
+                             if (select(data_old.value[iold],
+                                        data_new.value[inew])) {
+                               data_new.value[inew] = data_old.value[iold];
+                               data_new.variance[inew] =
+                                   data_old.variance[iold];
+                             }
+                           } else if (select(data_old[iold], data_new[inew])) {
+                             data_new[inew] = data_old[iold];
+                           }
+                         });
+}
+
+/// Element type of the spans passed to the kernels.
+template <class T> struct element_type {
+  using type = typename T::value_type;
+};
+template <class T> struct element_type<ValueAndVariance<std::span<T>>> {
+  using type = std::remove_const_t<T>;
+};
+template <class T>
+using element_type_t = typename element_type<std::decay_t<T>>::type;
+
+constexpr auto common = overloaded{
     [](const units::Unit &target_edges, const units::Unit &data,
        const units::Unit &edges) {
       if (target_edges != edges)
@@ -78,4 +131,106 @@ static constexpr auto rebin = overloaded{
     transform_flags::expect_no_variance_arg<1>,
     transform_flags::expect_no_variance_arg<3>};
 
+template <class Out, class Edge>
+using args = std::tuple<std::span<Out>, std::span<const Edge>,
+                        std::span<const Out>, std::span<const Edge>>;
+
+constexpr auto select_args =
+    element::arg_list<args<double, double>, args<double, float>,
+                      args<float, double>, args<float, float>,
+                      args<int64_t, double>, args<int64_t, float>,
+                      args<int32_t, double>, args<int32_t, float>>;
+} // namespace rebin_detail
+
+template <class Less>
+static constexpr auto rebin = overloaded{
+    rebin_detail::common,
+    [](const auto &data_new, const auto &xnew, const auto &data_old,
+       const auto &xold) {
+      zero(data_new);
+      rebin_detail::for_each_overlap<Less>(
+          xnew, xold,
+          [&](const scipp::index inew, const scipp::index iold,
+              const auto delta, const auto owidth) {
+            const auto scale = delta / owidth;
+            if constexpr (is_ValueAndVariance_v<
+                              std::decay_t<decltype(data_old)>>) {
+              data_new.value[inew] += data_old.value[iold] * scale;
+              data_new.variance[inew] += data_old.variance[iold] * scale;
+            } else if constexpr (std::is_same_v<typename std::decay_t<
+                                                    decltype(data_new)>::
+                                                    value_type,
+                                                bool>) {
+              static_cast<void>(scale);
+              data_new[inew] = data_new[inew] || data_old[iold];
+            } else {
+              data_new[inew] += data_old[iold] * scale;
+            }
+          });
+    }};
+
+/// Mean of the old values overlapping every new bin, weighted by the width of
+/// the overlap. Parts of new bins outside the old edges are ignored, new bins
+/// without any overlap are NaN.
+template <class Less>
+static constexpr auto resample_mean = overloaded{
+    rebin_detail::common,
+    element::arg_list<rebin_detail::args<double, double>,
+                      rebin_detail::args<double, float>,
+                      rebin_detail::args<float, double>,
+                      rebin_detail::args<float, float>>,
+    [](const auto &data_new, const auto &xnew, const auto &data_old,
+       const auto &xold) {
+      zero(data_new);
+      rebin_detail::for_each_overlap<Less>(
+          xnew, xold,
+          [&](const scipp::index inew, const scipp::index iold,
+              const auto delta, const auto) {
+            if constexpr (is_ValueAndVariance_v<
+                              std::decay_t<decltype(data_old)>>) {
+              data_new.value[inew] += data_old.value[iold] * delta;
+              data_new.variance[inew] +=
+                  data_old.variance[iold] * (delta * delta);
+            } else {
+              data_new[inew] += data_old[iold] * delta;
+            }
+          });
+      for (scipp::index inew = 0; inew < scipp::size(xnew) - 1; ++inew) {
+        const auto width = rebin_detail::covered_width<Less>(xnew, xold, inew);
+        if constexpr (is_ValueAndVariance_v<
+                          std::decay_t<decltype(data_new)>>) {
+          data_new.value[inew] /= width;
+          data_new.variance[inew] /= width * width;
+        } else {
+          data_new[inew] /= width;
+        }
+      }
+    }};
+
+/// Maximum of the old values overlapping every new bin. New bins without any
+/// overlap are set to the lowest value of the type, as in `max`.
+template <class Less>
+static constexpr auto resample_max = overloaded{
+    rebin_detail::common, rebin_detail::select_args,
+    [](const auto &data_new, const auto &xnew, const auto &data_old,
+       const auto &xold) {
+      using T = rebin_detail::element_type_t<decltype(data_new)>;
+      rebin_detail::select_overlapping<Less>(
+          data_new, xnew, data_old, xold, std::greater<>{},
+          std::numeric_limits<T>::lowest());
+    }};
+
+/// Minimum of the old values overlapping every new bin. New bins without any
+/// overlap are set to the maximum value of the type, as in `min`.
+template <class Less>
+static constexpr auto resample_min = overloaded{
+    rebin_detail::common, rebin_detail::select_args,
+    [](const auto &data_new, const auto &xnew, const auto &data_old,
+       const auto &xold) {
+      using T = rebin_detail::element_type_t<decltype(data_new)>;
+      rebin_detail::select_overlapping<Less>(
+          data_new, xnew, data_old, xold, std::less<>{},
+          std::numeric_limits<T>::max());
+    }};
+
 } // namespace scipp::core::element
@@ -93,6 +93,12 @@ constexpr auto islinspace =
                [](const units::Unit &) { return units::one; },
                [](const auto &range) { return numeric::islinspace(range); }};
 
+constexpr auto islogspace =
+    overloaded{arg_list<std::span<const double>, std::span<const float>>,
+               transform_flags::expect_no_variance_arg<0>,
+               [](const units::Unit &) { return units::one; },
+               [](const auto &range) { return numeric::islogspace(range); }};
+
 constexpr auto zip =
     overloaded{arg_list<int64_t>, transform_flags::expect_no_variance_arg<0>,
                transform_flags::expect_no_variance_arg<1>,
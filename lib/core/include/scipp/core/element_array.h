@@ -5,17 +5,53 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <stdexcept>
 
 #include "scipp/common/index.h"
+#include "scipp/core/mapped_file.h"
+#include "scipp/core/memory_pool.h"
+#include "scipp/core/memory_usage.h"
 #include "scipp/core/parallel.h"
 
 namespace scipp::core {
 
-/// Replacement for C++20 std::make_unique_for_overwrite
-template <class T> auto make_unique_for_overwrite(const scipp::index size) {
-  return std::unique_ptr<T>(new std::remove_extent_t<T>[size]);
+namespace detail {
+/// Deleter for arrays allocated from the memory pool.
+///
+/// Arrays referring to a memory-mapped file instead hold a reference to the
+/// file, which is released when the deleter is destroyed or replaced.
+template <class T> struct PoolDeleter {
+  scipp::index size{0};
+  std::shared_ptr<const MappedFile> mapping{};
+  void operator()(T *ptr) const noexcept {
+    if (mapping)
+      return;
+    std::destroy_n(ptr, size);
+    instance().deallocate(ptr);
+    record_deallocation(size * scipp::index{sizeof(T)});
+  }
+};
+
+template <class T> using pool_array = std::unique_ptr<T[], PoolDeleter<T>>;
+
+/// Allocate array of default-initialized elements from the memory pool.
+template <class T> pool_array<T> make_pool_array(const scipp::index size) {
+  static_assert(alignof(T) <= MemoryPool::alignment);
+  auto *ptr = static_cast<T *>(instance().allocate(size * sizeof(T)));
+  try {
+    std::uninitialized_default_construct_n(ptr, size);
+  } catch (...) {
+    instance().deallocate(ptr);
+    throw;
+  }
+  record_allocation(size * scipp::index{sizeof(T)});
+  return pool_array<T>(ptr, PoolDeleter<T>{size});
 }
+} // namespace detail
 
 /// Tag for requesting default-initialization in methods of class element_array.
 struct init_for_overwrite_t {};
@@ -33,14 +69,24 @@ static constexpr auto init_for_overwrite = init_for_overwrite_t{};
 /// - As a minor benefit, since the implementation has to store a pointer and a
 ///   size, we can at the same time support an "optional" behavior, as used for
 ///   the array of variances in a variable.
+/// - Arrays of a single small trivially copyable element, as used by 0-D
+///   variables, are stored inline without allocating memory. Unlike for other
+///   arrays, moving such an array changes its data pointer.
 template <class T> class element_array {
 public:
   using value_type = T;
+  /// Maximum number of elements stored inline.
+  static constexpr scipp::index inline_capacity =
+      std::is_trivially_copyable_v<T> && sizeof(T) <= 16 ? 1 : 0;
 
   element_array() noexcept = default;
 
   explicit element_array(const scipp::index new_size, const T &value = T()) {
     resize(new_size, init_for_overwrite);
+    if (is_inline()) {
+      std::fill_n(data(), size(), value);
+      return;
+    }
     parallel::parallel_for(
         parallel::blocked_range(0, size()), [&](const auto &range) {
           std::fill(data() + range.begin(), data() + range.end(), value);
@@ -60,6 +106,10 @@ public:
   element_array(Iter first, Iter last) {
     const scipp::index size = std::distance(first, last);
     resize(size, init_for_overwrite);
+    if (is_inline()) {
+      std::copy(first, last, data());
+      return;
+    }
     parallel::parallel_for(
         parallel::blocked_range(0, size), [&](const auto &range) {
           std::copy(first + range.begin(), first + range.end(),
@@ -77,8 +127,30 @@ public:
   element_array(std::initializer_list<T> init)
       : element_array(init.begin(), init.end()) {}
 
+  /// Construct array referring to `size` elements stored at byte `offset` of
+  /// a memory-mapped file, without copying.
+  ///
+  /// Writing to the array is undefined behavior if the file is mapped with
+  /// MapMode::ReadOnly. Copies of the array are allocated in memory as usual.
+  element_array(std::shared_ptr<const MappedFile> file,
+                const scipp::index offset, const scipp::index size) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable types can be memory-mapped.");
+    if (offset < 0 || size < 0 ||
+        offset + size * scipp::index{sizeof(T)} > file->size())
+      throw std::out_of_range("Requested range exceeds size of file '" +
+                              file->path() + "'.");
+    if (offset % alignof(T) != 0)
+      throw std::invalid_argument(
+          "Offset into memory-mapped file is not aligned for element type.");
+    auto *ptr = reinterpret_cast<T *>(file->data() + offset);
+    m_data = detail::pool_array<T>(ptr, {size, std::move(file)});
+    m_size = size;
+  }
+
   element_array(element_array &&other) noexcept
-      : m_size(other.m_size), m_data(std::move(other.m_data)) {
+      : m_size(other.m_size), m_data(std::move(other.m_data)),
+        m_inline(other.m_inline) {
     other.m_size = -1;
   }
 
@@ -87,6 +159,7 @@ public:
 
   element_array &operator=(element_array &&other) noexcept {
     m_data = std::move(other.m_data);
+    m_inline = other.m_inline;
     m_size = other.m_size;
     other.m_size = -1;
     return *this;
@@ -99,8 +172,16 @@ public:
   explicit operator bool() const noexcept { return m_size != -1; }
   scipp::index size() const noexcept { return m_size; }
   [[nodiscard]] bool empty() const noexcept { return size() == 0; }
-  const T *data() const noexcept { return m_data.get(); }
-  T *data() noexcept { return m_data.get(); }
+  const T *data() const noexcept {
+    return is_inline() ? std::launder(reinterpret_cast<const T *>(
+                             m_inline.data()))
+                       : m_data.get();
+  }
+  T *data() noexcept {
+    return is_inline()
+               ? std::launder(reinterpret_cast<T *>(m_inline.data()))
+               : m_data.get();
+  }
   const T *begin() const noexcept { return data(); }
   T *begin() noexcept { return data(); }
   const T *end() const noexcept {
@@ -108,8 +189,13 @@ public:
   }
   T *end() noexcept { return m_size < 0 ? begin() : data() + size(); }
 
+  /// Return the file the elements are stored in, nullptr if not file-backed.
+  const std::shared_ptr<const MappedFile> &mapping() const noexcept {
+    return m_data.get_deleter().mapping;
+  }
+
   void reset() noexcept {
-    m_data.reset();
+    m_data = detail::pool_array<T>();
     m_size = -1;
   }
 
@@ -122,15 +208,24 @@ public:
   /// Resize with default-initialized elements. Use with care.
   void resize(const scipp::index new_size, const init_for_overwrite_t &) {
     if (new_size == 0) {
-      m_data.reset();
+      m_data = detail::pool_array<T>();
       m_size = 0;
-    } else if (new_size != size()) {
-      m_data = make_unique_for_overwrite<T[]>(new_size);
+    } else if (new_size <= inline_capacity) {
+      m_data = detail::pool_array<T>();
+      std::uninitialized_default_construct_n(
+          reinterpret_cast<T *>(m_inline.data()), new_size);
+      m_size = new_size;
+    } else if (new_size != size() || mapping()) {
+      m_data = detail::make_pool_array<T>(new_size);
       m_size = new_size;
     }
   }
 
 private:
+  [[nodiscard]] bool is_inline() const noexcept {
+    return !m_data && m_size > 0;
+  }
+
   element_array from_other(const element_array &other) {
     if (other.size() == -1) {
       return element_array();
@@ -141,7 +236,8 @@ private:
     }
   }
   scipp::index m_size{-1};
-  std::unique_ptr<T[]> m_data;
+  detail::pool_array<T> m_data;
+  alignas(T) std::array<std::byte, inline_capacity * sizeof(T)> m_inline{};
 };
 
 } // namespace scipp::core
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+/// @author Simon Heybrock
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "scipp/common/index.h"
+
+namespace scipp::core {
+
+/// Helper of `bin` for mapping group labels to the index of their group.
+///
+/// The lookup is the innermost operation when grouping events, so the storage
+/// depends on the labels: Integer labels spanning a range not much larger than
+/// the number of groups use a lookup table indexed by `label - min`, other
+/// integer labels use a sorted array. All other labels use a flat hash table
+/// with open addressing.
+template <class T, class Index> class GroupMap {
+public:
+  GroupMap() = default;
+  explicit GroupMap(std::span<const T> labels)
+      : m_labels(labels.begin(), labels.end()) {
+    if constexpr (is_integer)
+      init_integer();
+    else
+      init_hash();
+  }
+
+  [[nodiscard]] scipp::index size() const noexcept {
+    return scipp::size(m_labels);
+  }
+
+  /// Return the index of the group with given label, or -1 if there is none.
+  [[nodiscard]] Index find(const T &label) const noexcept {
+    if constexpr (is_integer) {
+      if (!m_table.empty()) {
+        // Labels below `m_min` wrap around and are rejected as well.
+        const auto i =
+            static_cast<uint64_t>(label) - static_cast<uint64_t>(m_min);
+        return i < m_table.size() ? m_table[i] : Index{-1};
+      }
+      const auto it = std::lower_bound(
+          m_sorted.begin(), m_sorted.end(), label,
+          [](const auto &item, const T &x) { return item.first < x; });
+      return it == m_sorted.end() || it->first != label ? Index{-1}
+                                                        : it->second;
+    } else {
+      if (m_table.empty())
+        return -1;
+      const auto hash = hash_of(label);
+      for (auto slot = hash & m_mask;; slot = (slot + 1) & m_mask) {
+        const auto group = m_table[slot];
+        if (group < 0)
+          return -1;
+        if (m_hashes[slot] == hash && m_labels[group] == label)
+          return group;
+      }
+    }
+  }
+
+  bool operator==(const GroupMap &other) const noexcept {
+    return m_labels == other.m_labels;
+  }
+
+private:
+  static constexpr bool is_integer =
+      std::is_integral_v<T> && !std::is_same_v<T, bool>;
+  /// Maximum ratio of the label range and the number of groups for which a
+  /// lookup table is used.
+  static constexpr uint64_t max_table_ratio = 4;
+
+  [[noreturn]] static void throw_duplicate() {
+    throw std::runtime_error("Duplicate group labels.");
+  }
+
+  static uint64_t hash_of(const T &label) noexcept {
+    // Finalizer of MurmurHash3, std::hash is the identity for some types.
+    auto h = static_cast<uint64_t>(std::hash<T>{}(label));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  void init_integer() {
+    if (m_labels.empty())
+      return;
+    const auto [min, max] =
+        std::minmax_element(m_labels.begin(), m_labels.end());
+    const auto range =
+        static_cast<uint64_t>(*max) - static_cast<uint64_t>(*min);
+    if (range < max_table_ratio * m_labels.size()) {
+      m_min = *min;
+      m_table.assign(range + 1, -1);
+      for (scipp::index group = 0; group < size(); ++group) {
+        auto &entry = m_table[static_cast<uint64_t>(m_labels[group]) -
+                              static_cast<uint64_t>(m_min)];
+        if (entry != -1)
+          throw_duplicate();
+        entry = static_cast<Index>(group);
+      }
+    } else {
+      m_sorted.reserve(m_labels.size());
+      for (scipp::index group = 0; group < size(); ++group)
+        m_sorted.emplace_back(m_labels[group], static_cast<Index>(group));
+      std::sort(m_sorted.begin(), m_sorted.end());
+      if (std::adjacent_find(m_sorted.begin(), m_sorted.end(),
+                             [](const auto &a, const auto &b) {
+                               return a.first == b.first;
+                             }) != m_sorted.end())
+        throw_duplicate();
+    }
+  }
+
+  void init_hash() {
+    // Load factor of at most 0.5 keeps probe sequences short.
+    const auto capacity = std::bit_ceil(2 * m_labels.size() + 1);
+    m_mask = capacity - 1;
+    m_table.assign(capacity, -1);
+    m_hashes.resize(capacity);
+    for (scipp::index group = 0; group < size(); ++group) {
+      const auto &label = m_labels[group];
+      if (find(label) != -1)
+        throw_duplicate();
+      const auto hash = hash_of(label);
+      auto slot = hash & m_mask;
+      while (m_table[slot] != -1)
+        slot = (slot + 1) & m_mask;
+      m_table[slot] = static_cast<Index>(group);
+      m_hashes[slot] = hash;
+    }
+  }
+
+  /// Labels in order of their group index.
+  std::vector<T> m_labels;
+  /// Lookup table for integer labels, or slots of the hash table.
+  std::vector<Index> m_table;
+  T m_min{};
+  std::vector<std::pair<T, Index>> m_sorted;
+  std::vector<uint64_t> m_hashes;
+  uint64_t m_mask{0};
+};
+
+} // namespace scipp::core
@@ -5,8 +5,11 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
 #include <tuple>
+#include <vector>
 
+#include "scipp/common/index.h"
 #include "scipp/core/except.h"
 
 namespace scipp::core {
@@ -20,6 +23,96 @@ constexpr static auto linear_edge_params = [](const auto &edges) {
   return std::tuple{offset, nbin, scale};
 };
 
+/// Return params for computing bin index for logarithmic edges (constant ratio
+/// of neighboring edges).
+constexpr static auto log_edge_params = [](const auto &edges) {
+  const auto nbin = scipp::size(edges) - 1;
+  const auto offset = std::log(static_cast<double>(edges.front()));
+  const auto scale = static_cast<double>(nbin) /
+                     (std::log(static_cast<double>(edges.back())) - offset);
+  return std::tuple{offset, nbin, scale};
+};
+
+/// Return index of the bin of logarithmic `edges` containing `x`, or -1 if `x`
+/// is outside the edges.
+///
+/// The estimate from `log_edge_params` may be off due to rounding and is
+/// corrected by comparison with the neighboring edges, such that the result
+/// is identical to that of a binary search.
+template <class Edges, class T>
+scipp::index log_edge_bin(const Edges &edges, const double offset,
+                          const scipp::index nbin, const double scale,
+                          const T &x) {
+  if (!(x >= edges.front() && x < edges.back()))
+    return -1;
+  auto bin = static_cast<scipp::index>(
+      (std::log(static_cast<double>(x)) - offset) * scale);
+  bin = std::clamp(bin, scipp::index{0}, nbin - 1);
+  while (x < edges[bin])
+    --bin;
+  while (!(x < edges[bin + 1]))
+    ++bin;
+  return bin;
+}
+
+/// Lookup of the bin containing a value for arbitrary sorted edges.
+///
+/// The range of the edges is divided into equal cells, each storing the range
+/// of edges it intersects, such that only a few edges need to be searched for
+/// every lookup. Construction is linear in the number of edges, so this pays
+/// off if there are many more values than edges.
+template <class Edges> class SortedEdgeLookup {
+public:
+  explicit SortedEdgeLookup(const Edges &edges) : m_edges(edges) {
+    const auto nedge = scipp::size(edges);
+    const auto front = static_cast<double>(edges.front());
+    const auto back = static_cast<double>(edges.back());
+    if (nedge < 2 || !(back > front))
+      return;
+    const auto ncell = nedge;
+    m_front = front;
+    m_scale = static_cast<double>(ncell) / (back - front);
+    m_first.resize(ncell + 1);
+    scipp::index edge = 0;
+    for (scipp::index cell = 0; cell <= ncell; ++cell) {
+      const auto start = front + static_cast<double>(cell) / m_scale;
+      while (edge + 1 < nedge && !(start < edges[edge + 1]))
+        ++edge;
+      m_first[cell] = edge;
+    }
+  }
+
+  /// Return index of the bin containing `x`, or -1 if `x` is outside the edges.
+  template <class T> scipp::index operator()(const T &x) const {
+    const auto nedge = scipp::size(m_edges);
+    if (!(x >= m_edges.front() && x < m_edges.back()))
+      return -1;
+    auto first = m_edges.begin();
+    auto last = m_edges.end();
+    if (!m_first.empty()) {
+      const auto ncell = scipp::size(m_first) - 1;
+      const auto cell = std::min(
+          static_cast<scipp::index>((static_cast<double>(x) - m_front) *
+                                    m_scale),
+          ncell - 1);
+      // Search range is validated since the cell may be off due to rounding.
+      const auto lo = m_first[cell];
+      const auto hi = std::min(m_first[cell + 1] + 2, nedge);
+      if (m_edges[lo] <= x && (hi == nedge || x < m_edges[hi])) {
+        first += lo;
+        last = m_edges.begin() + hi;
+      }
+    }
+    return std::upper_bound(first, last, x) - m_edges.begin() - 1;
+  }
+
+private:
+  Edges m_edges;
+  double m_front{0.0};
+  double m_scale{0.0};
+  std::vector<scipp::index> m_first;
+};
+
 namespace expect::histogram {
 template <class T> void sorted_edges(const T &edges) {
   if (!std::is_sorted(edges.begin(), edges.end()))
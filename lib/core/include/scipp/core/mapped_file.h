@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file Memory-mapped files used as storage of element arrays.
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "scipp-core_export.h"
+#include "scipp/common/index.h"
+
+namespace scipp::core {
+
+/// Access mode of a memory-mapped file.
+enum class MapMode {
+  /// Mapping is read-only, writing through the mapping is not possible.
+  ReadOnly,
+  /// Mapping is writable, but writes are private to the process and never
+  /// written back to the file. Pages are copied on first write.
+  CopyOnWrite
+};
+
+/// A file mapped into memory in its entirety.
+///
+/// Pages are loaded lazily by the operating system when they are accessed and
+/// can be evicted again under memory pressure, so files larger than the
+/// available memory can be mapped.
+class SCIPP_CORE_EXPORT MappedFile {
+public:
+  MappedFile(const std::string &path, MapMode mode);
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile();
+
+  [[nodiscard]] std::byte *data() const noexcept { return m_data; }
+  /// Size of the file in bytes.
+  [[nodiscard]] scipp::index size() const noexcept { return m_size; }
+  [[nodiscard]] MapMode mode() const noexcept { return m_mode; }
+  [[nodiscard]] const std::string &path() const noexcept { return m_path; }
+
+private:
+  std::string m_path;
+  MapMode m_mode;
+  std::byte *m_data{nullptr};
+  scipp::index m_size{0};
+};
+
+} // namespace scipp::core
@@ -4,12 +4,11 @@
 /// @author Simon Heybrock
 #pragma once
 
-#include <array>
-#include <map>
-#include <mutex>
-#include <vector>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
 
-#include "scipp/common/index.h"
+#include "scipp-core_export.h"
 
 namespace scipp::core {
 #ifdef _WIN32
@@ -37,62 +36,53 @@ static int posix_memalign(void **ptr, size_t align, size_t size) {
 }
 #endif
 
-class MemoryPool {
+/// Pooled allocator for array buffers.
+///
+/// Blocks are grouped into power-of-two size classes. Freed blocks are kept in
+/// a cache local to the freeing thread and reused by subsequent allocations of
+/// the same size class, avoiding the cost of `malloc` and page faults for the
+/// many short-lived temporaries created by typical operations. Each block has
+/// a small header storing its size class, so `deallocate` is O(1) and does not
+/// require a lookup. Thread caches that exceed `thread_cache_limit` bytes pass
+/// blocks on to a shared cache, which in turn returns blocks to the system
+/// once it exceeds `shared_cache_limit` bytes.
+///
+/// Blocks larger than `max_pooled_size` are not cached. They are aligned to
+/// `huge_page_size` and transparent huge pages are requested for them (Linux
+/// only), reducing TLB misses when streaming through large arrays.
+///
+/// All returned pointers are aligned to `alignment` bytes. The pool can be
+/// disabled at runtime, in which case every call goes to the system
+/// allocator. Blocks may be freed regardless of whether the pool was enabled
+/// when allocating them.
+class SCIPP_CORE_EXPORT MemoryPool {
 public:
-  void *allocate(size_t size) const {
-    std::lock_guard<std::mutex> g(m_mutex);
-    auto &pools = m_pools[size];
-    if (pools[1].empty()) {
-      void *ptr = nullptr;
-      // Always 64 bit aligned
-      int rc = posix_memalign(&ptr, 64, size);
-      if (rc != 0)
-        throw std::runtime_error("Failed to allocate.");
-      pools[0].emplace_back(ptr);
-      return ptr;
-    } else {
-      pools[0].emplace_back(pools[1].back());
-      pools[1].pop_back();
-      return pools[0].back();
-    }
-  }
-  void deallocate(void *ptr) const {
-    std::lock_guard<std::mutex> g(m_mutex);
-    for (auto &pools : m_pools) {
-      auto &used = pools.second[0];
-      for (scipp::index i = used.size() - 1; i >= 0; --i) {
-        if (used[i] == ptr) {
-          auto &unused = pools.second[1];
-          used.erase(used.begin() + i);
-          unused.emplace_back(ptr);
-          return;
-        }
-      }
-    }
-    throw std::runtime_error(
-        "Request to deallocate memory that is not owned by us.");
-  }
-  ~MemoryPool() {
-    for (auto &pools : m_pools) {
-      for (auto &pool : pools.second)
-        for (auto &ptr : pool)
-#ifdef _WIN32
-          _aligned_free(ptr);
-#else
-          free(ptr);
-#endif
-    }
-  }
+  static constexpr size_t alignment = 64;
+  /// Allocations larger than this are never cached.
+  static constexpr size_t max_pooled_size = size_t{1} << 22;
+  static constexpr size_t huge_page_size = size_t{1} << 21;
+  static constexpr size_t thread_cache_limit = size_t{32} << 20;
+  static constexpr size_t shared_cache_limit = size_t{256} << 20;
+
+  /// Allocate at least `size` bytes. Throws std::bad_alloc on failure.
+  [[nodiscard]] void *allocate(size_t size) const;
+  /// Free a block returned by `allocate`. `ptr` may be nullptr.
+  void deallocate(void *ptr) const noexcept;
 
-private:
-  mutable std::mutex m_mutex;
-  // Different pool for each size.
-  mutable std::map<size_t, std::array<std::vector<void *>, 2>> m_pools;
+  /// Enable or disable caching of freed blocks. Disabling frees all cached
+  /// blocks, see `trim`.
+  void set_enabled(bool enabled) const noexcept;
+  [[nodiscard]] bool enabled() const noexcept;
+
+  /// Return cached blocks of the shared cache and the caches of all threads,
+  /// including idle worker threads, to the system.
+  void trim() const noexcept;
+  /// Total size in bytes of blocks cached in the shared cache and the caches
+  /// of all threads.
+  [[nodiscard]] size_t cached_bytes() const noexcept;
 };
 
-inline MemoryPool &instance() {
-  static MemoryPool pool;
-  return pool;
-}
+/// Return the process-wide memory pool.
+SCIPP_CORE_EXPORT MemoryPool &instance();
 
 } // namespace scipp::core
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file Accounting of memory held by array buffers.
+#pragma once
+
+#include <map>
+
+#include "scipp-core_export.h"
+#include "scipp/common/index.h"
+#include "scipp/core/dtype.h"
+
+namespace scipp::core {
+
+/// Process-wide statistics of memory held by element_array buffers.
+struct MemoryStats {
+  /// Bytes in live buffers.
+  scipp::index current_bytes{0};
+  /// Maximum of `current_bytes` since start or the last `reset_peak_memory`.
+  scipp::index peak_bytes{0};
+  /// Number of buffers allocated since start.
+  scipp::index allocations{0};
+};
+
+/// Memory referenced by an object such as a variable.
+struct MemoryUsage {
+  /// Bytes of all buffers, including parts not visible in slices.
+  scipp::index bytes{0};
+  /// Bytes of bin buffers not referenced by any bin.
+  scipp::index unused_bytes{0};
+
+  MemoryUsage &operator+=(const MemoryUsage &other) noexcept {
+    bytes += other.bytes;
+    unused_bytes += other.unused_bytes;
+    return *this;
+  }
+};
+
+[[nodiscard]] SCIPP_CORE_EXPORT MemoryStats memory_stats() noexcept;
+SCIPP_CORE_EXPORT void reset_peak_memory() noexcept;
+/// Return bytes held by variable buffers, grouped by dtype.
+[[nodiscard]] SCIPP_CORE_EXPORT std::map<DType, scipp::index>
+memory_by_dtype();
+
+namespace detail {
+SCIPP_CORE_EXPORT void record_allocation(scipp::index bytes) noexcept;
+SCIPP_CORE_EXPORT void record_deallocation(scipp::index bytes) noexcept;
+SCIPP_CORE_EXPORT void record_dtype_bytes(DType dtype,
+                                          scipp::index delta) noexcept;
+} // namespace detail
+
+/// Records bytes held by a variable buffer of given dtype in the statistics
+/// returned by `memory_by_dtype`, for the lifetime of the record.
+class DTypeMemoryRecord {
+public:
+  explicit DTypeMemoryRecord(const DType dtype) noexcept : m_dtype(dtype) {}
+  DTypeMemoryRecord(const DTypeMemoryRecord &other) noexcept
+      : m_dtype(other.m_dtype) {
+    set(other.m_bytes);
+  }
+  DTypeMemoryRecord &operator=(const DTypeMemoryRecord &other) noexcept {
+    set(other.m_bytes);
+    return *this;
+  }
+  ~DTypeMemoryRecord() { set(0); }
+
+  void set(const scipp::index bytes) noexcept {
+    if (bytes != m_bytes)
+      detail::record_dtype_bytes(m_dtype, bytes - m_bytes);
+    m_bytes = bytes;
+  }
+
+private:
+  DType m_dtype;
+  scipp::index m_bytes{0};
+};
+
+} // namespace scipp::core
@@ -7,6 +7,7 @@
 #include <functional>
 #include <numeric>
 #include <optional>
+#include <vector>
 
 #include "scipp/common/index_composition.h"
 #include "scipp/core/dimensions.h"
@@ -112,6 +113,58 @@ public:
     }
   }
 
+  /// Return true if iteration over bins can start or end in the middle of a
+  /// bin, see `set_index(bin, offset)`.
+  ///
+  /// This requires bins with a single (flattened) inner dimension. The first
+  /// operand must be binned, such that tasks running concurrently on parts of
+  /// the same bin do not write to the same element.
+  [[nodiscard]] bool can_split_bins() const noexcept {
+    return has_bins() && m_inner_ndim == 1 && m_bin[0].m_is_binned;
+  }
+
+  /// Set the index of the bin and the offset within that bin.
+  ///
+  /// Requires `can_split_bins()` and an offset less than the size of the bin.
+  void set_index(const scipp::index bin, const scipp::index offset) noexcept {
+    set_bins_index(bin);
+    if (offset == 0)
+      return;
+    for (scipp::index data = 0; data < N; ++data)
+      m_data_index[data] += offset * m_stride[0][data];
+    m_coord[0] = offset;
+  }
+
+  /// Return the cumulative sizes of bins in the order of iteration.
+  ///
+  /// Element `i` is the total size of all bins before bin `i`, the final
+  /// element is the total size of all bins. Requires `has_bins()`.
+  [[nodiscard]] std::vector<scipp::index> cumulative_bin_sizes() const {
+    scipp::index data = 0;
+    while (!m_bin[data].m_is_binned)
+      ++data;
+    const auto *indices = m_bin[data].m_indices;
+    const auto nbins = std::accumulate(
+        m_shape.begin() + m_inner_ndim, m_shape.begin() + m_ndim,
+        scipp::index{1}, std::multiplies<>{});
+    std::vector<scipp::index> cumulative(nbins + 1, 0);
+    std::array<scipp::index, NDIM_MAX + 1> coord{};
+    scipp::index bin = 0;
+    for (scipp::index i = 0; i < nbins; ++i) {
+      const auto size =
+          indices == nullptr ? 0 : indices[bin].second - indices[bin].first;
+      cumulative[i + 1] = cumulative[i] + size;
+      for (scipp::index dim = m_inner_ndim; dim < m_ndim; ++dim) {
+        bin += m_stride[dim][data];
+        if (++coord[dim] < m_shape[dim])
+          break;
+        bin -= coord[dim] * m_stride[dim][data];
+        coord[dim] = 0;
+      }
+    }
+    return cumulative;
+  }
+
   void set_to_end() noexcept {
     if (has_bins()) {
       set_to_end_bin();
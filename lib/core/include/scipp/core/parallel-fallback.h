@@ -5,12 +5,26 @@
 #pragma once
 
 #include <algorithm>
+#include <stdexcept>
 
 #include "scipp/common/index.h"
+#include "scipp/core/parallel_cost.h"
 
 /// Fallback wrappers without actual threading, in case TBB is not available.
 namespace scipp::core::parallel {
 
+/// Return the maximum number of threads used by parallel algorithms, always 1.
+[[nodiscard]] inline scipp::index max_threads() noexcept { return 1; }
+/// Has no effect apart from validating `n`, there is only a single thread.
+inline void set_max_threads(const scipp::index n) {
+  if (n < 1)
+    throw std::invalid_argument("Number of threads must be at least 1.");
+}
+/// Has no effect, there is only a single thread.
+inline void reset_max_threads() noexcept {}
+/// Always true, there is only a single thread.
+[[nodiscard]] inline bool max_threads_is_default() noexcept { return true; }
+
 class blocked_range {
 public:
   constexpr blocked_range(const scipp::index begin, const scipp::index end,
@@ -18,6 +32,11 @@ public:
       : m_begin(begin), m_end(end) {
     static_cast<void>(grainsize);
   }
+  constexpr blocked_range(const scipp::index begin, const scipp::index end,
+                          const ElementCost &cost) noexcept
+      : m_begin(begin), m_end(end) {
+    static_cast<void>(cost);
+  }
   constexpr scipp::index begin() const noexcept { return m_begin; }
   constexpr scipp::index end() const noexcept { return m_end; }
 
@@ -5,43 +5,108 @@
 #pragma once
 
 #include <algorithm>
+#include <memory>
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
 
+#include "scipp-core_export.h"
 #include "scipp/common/index.h"
+#include "scipp/core/parallel_cost.h"
 #cmakedefine ENABLE_THREAD_LIMIT
 // clang-format off
 #cmakedefine THREAD_LIMIT @THREAD_LIMIT@
 // clang-format on
 
 /// Wrappers for multi-threading using TBB.
+///
+/// All parallel algorithms are executed in a single task arena that is created
+/// on first use and kept alive for the lifetime of the process. Its concurrency
+/// can be changed at runtime using `set_max_threads`.
 namespace scipp::core::parallel {
 
+/// Return the maximum number of threads used by parallel algorithms.
+[[nodiscard]] SCIPP_CORE_EXPORT scipp::index max_threads() noexcept;
+/// Set the maximum number of threads used by parallel algorithms.
+///
+/// Must not be called from within a parallel algorithm. Algorithms that are
+/// already running in other threads continue with the previous limit.
+SCIPP_CORE_EXPORT void set_max_threads(scipp::index n);
+/// Restore the default maximum number of threads, i.e., the number of cores,
+/// or THREAD_LIMIT if configured with ENABLE_THREAD_LIMIT.
+SCIPP_CORE_EXPORT void reset_max_threads();
+/// Return true unless the maximum number of threads has been set explicitly
+/// using `set_max_threads`.
+[[nodiscard]] SCIPP_CORE_EXPORT bool max_threads_is_default() noexcept;
+
+namespace detail {
+/// Return the shared arena, creating it if necessary.
+[[nodiscard]] SCIPP_CORE_EXPORT std::shared_ptr<tbb::task_arena> arena();
+/// Return true if the calling thread is currently executing a task of a
+/// parallel algorithm.
+[[nodiscard]] SCIPP_CORE_EXPORT bool in_parallel() noexcept;
+
+/// Mark the calling thread as executing a task of a parallel algorithm.
+class SCIPP_CORE_EXPORT ParallelScope {
+public:
+  ParallelScope() noexcept;
+  ~ParallelScope() noexcept;
+  ParallelScope(const ParallelScope &) = delete;
+  ParallelScope &operator=(const ParallelScope &) = delete;
+};
+
+/// Run `f` in the shared arena. Nested calls, i.e., calls from within a task
+/// that is already running in the arena, run `f` directly.
+template <class F> void execute(F &&f) {
+  if (in_parallel()) {
+    f();
+  } else {
+    const auto a = arena();
+    a->execute([&f]() {
+      const ParallelScope scope;
+      f();
+    });
+  }
+}
+} // namespace detail
+
 inline auto blocked_range(const scipp::index begin, const scipp::index end,
                           const scipp::index grainsize = -1) {
   // TBB's default grain-size is 1, which is probably quite inefficient in
-  // some cases, in particular given the slow random-access of ViewIndex. A
-  // good default value is not known right now. In practice this should also
-  // depend heavily on whether we are processing small elements like `double`
-  // or something large like `event_list<double>`.
+  // some cases, in particular given the slow random-access of ViewIndex. If
+  // the cost per element is known, prefer the overload taking `ElementCost`.
   return tbb::blocked_range<scipp::index>(
       begin, end,
       grainsize == -1 ? std::max(scipp::index(1), (end - begin) / 24)
                       : grainsize);
 }
 
-template <class... Args> void parallel_for(Args &&... args) {
-#ifdef ENABLE_THREAD_LIMIT
-  tbb::task_arena limited_arena(THREAD_LIMIT);
-  limited_arena.execute(
-      [&args...]() { tbb::parallel_for(std::forward<Args>(args)...); });
-#else
-  tbb::parallel_for(std::forward<Args>(args)...);
-#endif
+/// Return a range with grain size chosen based on the cost per element.
+inline auto blocked_range(const scipp::index begin, const scipp::index end,
+                          const ElementCost &cost) {
+  return blocked_range(begin, end,
+                       grain_size(end - begin, cost, max_threads()));
+}
+
+template <class Range, class Op>
+void parallel_for(const Range &range, Op &&op) {
+  // Ranges that would not be split run in the calling thread, without the
+  // overhead of entering the arena.
+  if (!range.is_divisible()) {
+    op(range);
+    return;
+  }
+  detail::execute([&range, &op]() {
+    tbb::parallel_for(range, [&op](const Range &r) {
+      const detail::ParallelScope scope;
+      op(r);
+    });
+  });
 }
 
 template <class... Args> void parallel_sort(Args &&... args) {
-  tbb::parallel_sort(std::forward<Args>(args)...);
+  detail::execute(
+      [&args...]() { tbb::parallel_sort(std::forward<Args>(args)...); });
 }
 
 } // namespace scipp::core::parallel
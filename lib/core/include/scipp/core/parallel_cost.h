@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file Cost model for choosing the grain size of parallel loops.
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "scipp/common/index.h"
+
+namespace scipp::core::parallel {
+
+/// Estimated cost of a single iteration of a parallel loop.
+struct ElementCost {
+  /// Bytes read or written per iteration, summed over all operands.
+  scipp::index bytes{sizeof(double)};
+  /// Relative compute cost per byte. 1 corresponds to simple arithmetic on
+  /// fundamental types, larger values to, e.g., strings or binned data.
+  double weight{1.0};
+};
+
+/// Target number of tasks per thread. More than one task per thread is
+/// required for work stealing to balance uneven progress of threads.
+constexpr scipp::index tasks_per_thread = 4;
+/// Minimum weighted size of a task in bytes. Smaller tasks would be dominated
+/// by scheduling overhead.
+constexpr double min_task_bytes = 64.0 * 1024;
+/// Maximum size of a task in bytes, such that data of a task fits into the
+/// (per-core) L2 cache.
+constexpr double max_task_bytes = 1024.0 * 1024;
+
+/// Return the grain size for a parallel loop with `size` iterations.
+///
+/// Aims for `tasks_per_thread` tasks per thread, but never splits into tasks
+/// with less work than `min_task_bytes` or more data than `max_task_bytes`
+/// (unless this would violate the former). Small inputs therefore result in a
+/// single task, which is run without threading.
+[[nodiscard]] inline scipp::index
+grain_size(const scipp::index size, const ElementCost &cost,
+           const scipp::index threads) noexcept {
+  const auto bytes = static_cast<double>(std::max(scipp::index{1}, cost.bytes));
+  const auto weight = std::max(cost.weight, 1e-3);
+  const auto min_grain = std::ceil(min_task_bytes / (bytes * weight));
+  const auto max_grain =
+      std::max(min_grain, std::floor(max_task_bytes / bytes));
+  const auto tasks = std::max(scipp::index{1}, threads * tasks_per_thread);
+  const auto target = std::ceil(static_cast<double>(size) / tasks);
+  const auto grain = std::clamp(target, min_grain, max_grain);
+  return std::max(scipp::index{1}, static_cast<scipp::index>(grain));
+}
+
+/// Return the number of tasks for a parallel loop with `size` iterations.
+[[nodiscard]] inline scipp::index task_count(const scipp::index size,
+                                             const ElementCost &cost,
+                                             const scipp::index threads) {
+  const auto grain = grain_size(size, cost, threads);
+  return (size + grain - 1) / grain;
+}
+
+/// Split items of varying size into `ntask` contiguous tasks of similar size.
+///
+/// Element `i` of `cumulative` is the total size of all items before item `i`,
+/// the final element is the total size of all items. Returns the boundaries
+/// of the tasks, starting with {0, 0} and ending with {n_item, 0}, as pairs
+/// of item index and offset within the item. If `split` is false all offsets
+/// are zero, i.e., tasks contain only complete items. Tasks may be merged, so
+/// there can be fewer than `ntask` tasks.
+[[nodiscard]] inline std::vector<std::pair<scipp::index, scipp::index>>
+weighted_partition(const std::span<const scipp::index> cumulative,
+                   const scipp::index ntask, const bool split) {
+  const auto n_item = scipp::size(cumulative) - 1;
+  const auto total = cumulative.back();
+  std::vector<std::pair<scipp::index, scipp::index>> bounds{{0, 0}};
+  for (scipp::index task = 1; task < ntask; ++task) {
+    const auto target = total / ntask * task + total % ntask * task / ntask;
+    auto item = std::distance(cumulative.begin(),
+                              std::upper_bound(cumulative.begin(),
+                                               cumulative.end(), target)) -
+                1;
+    auto offset = target - cumulative[item];
+    if (!split && offset != 0) {
+      // Move to the closer end of the item.
+      if (2 * offset >= cumulative[item + 1] - cumulative[item])
+        ++item;
+      offset = 0;
+    }
+    if (std::pair{item, offset} > bounds.back() && item < n_item)
+      bounds.emplace_back(item, offset);
+  }
+  bounds.emplace_back(n_item, 0);
+  return bounds;
+}
+
+} // namespace scipp::core::parallel
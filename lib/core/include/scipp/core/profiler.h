@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file Opt-in profiler for named operations.
+///
+/// Operations such as `transform` carry a descriptive name. When the profiler
+/// is enabled, every call of such an operation is recorded in a `Scope`,
+/// aggregated by name, and optionally logged as an event for export in the
+/// Chrome trace-event format (viewable in chrome://tracing or Perfetto).
+///
+/// When the profiler is disabled, recording a call only checks an atomic flag.
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "scipp-core_export.h"
+#include "scipp/common/index.h"
+
+namespace scipp::core::profiler {
+
+/// Implementation of the inner loop of a transform.
+enum class Loop {
+  /// Vectorized loop for contiguous operands with strides known at compile
+  /// time.
+  Vectorized,
+  /// Loop with strides known at compile time, see `stride_special_cases`.
+  Specialized,
+  /// Loop with strides known only at runtime.
+  Generic
+};
+
+/// Statistics of the work done by a single task of an operation, accumulated
+/// without synchronization.
+struct TaskStats {
+  scipp::index elements{0};
+  scipp::index bytes_read{0};
+  scipp::index bytes_written{0};
+  std::array<scipp::index, 3> chunks{};
+
+  void add_chunk(const Loop loop, const scipp::index size) noexcept {
+    elements += size;
+    ++chunks[static_cast<size_t>(loop)];
+  }
+};
+
+/// Aggregated statistics of all calls of an operation with a given name.
+struct OpStats {
+  std::string name;
+  scipp::index calls{0};
+  /// Total wall time in seconds. Includes the time of nested operations.
+  double seconds{0.0};
+  scipp::index elements{0};
+  scipp::index bytes_read{0};
+  scipp::index bytes_written{0};
+  /// Maximum number of distinct threads that ran tasks of any single call.
+  scipp::index max_threads{0};
+  /// Number of chunks processed by each implementation of the inner loop.
+  scipp::index vectorized_chunks{0};
+  scipp::index specialized_chunks{0};
+  scipp::index generic_chunks{0};
+};
+
+SCIPP_CORE_EXPORT void set_enabled(bool enabled);
+[[nodiscard]] SCIPP_CORE_EXPORT bool enabled() noexcept;
+/// Clear all recorded statistics and events.
+SCIPP_CORE_EXPORT void reset();
+
+/// Return statistics of all recorded operations, sorted by decreasing time.
+[[nodiscard]] SCIPP_CORE_EXPORT std::vector<OpStats> stats();
+/// Return a human-readable table of the recorded statistics.
+[[nodiscard]] SCIPP_CORE_EXPORT std::string summary();
+/// Return recorded events in the Chrome trace-event JSON format.
+///
+/// At most `max_events` events are kept, later calls are only included in the
+/// aggregated statistics.
+[[nodiscard]] SCIPP_CORE_EXPORT std::string chrome_trace();
+constexpr scipp::index max_events = 1000000;
+
+/// Records a single call of a named operation. Does nothing if the profiler
+/// is disabled when the scope is created.
+///
+/// While alive the scope is the current scope of the calling thread, see
+/// `current()`. Inner loops running on behalf of the operation add their
+/// statistics to the current scope. This is thread-safe, such that the scope
+/// can be attached to worker threads using `Attach`.
+class SCIPP_CORE_EXPORT Scope {
+public:
+  explicit Scope(std::string_view name);
+  Scope(const Scope &) = delete;
+  Scope &operator=(const Scope &) = delete;
+  ~Scope();
+
+  /// Record the work of one task. Tasks may run on different threads.
+  void add_task(const TaskStats &task) noexcept;
+
+private:
+  bool m_active;
+  std::string_view m_name;
+  Scope *m_parent{nullptr};
+  std::chrono::steady_clock::time_point m_start;
+  std::atomic<scipp::index> m_elements{0};
+  std::atomic<scipp::index> m_bytes_read{0};
+  std::atomic<scipp::index> m_bytes_written{0};
+  std::atomic<scipp::index> m_loops[3]{};
+  std::mutex m_threads_mutex;
+  /// Distinct threads that ran tasks of this call.
+  std::vector<std::thread::id> m_threads;
+};
+
+/// Return the current scope of the calling thread, or nullptr.
+[[nodiscard]] SCIPP_CORE_EXPORT Scope *current() noexcept;
+
+/// Make `scope` the current scope of the calling thread while alive. Used to
+/// attach worker threads to the operation they work for.
+class SCIPP_CORE_EXPORT Attach {
+public:
+  explicit Attach(Scope *scope) noexcept;
+  Attach(const Attach &) = delete;
+  Attach &operator=(const Attach &) = delete;
+  ~Attach();
+
+private:
+  Scope *m_previous;
+};
+
+} // namespace scipp::core::profiler
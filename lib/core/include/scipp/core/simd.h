@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file Runtime CPU-feature detection for vectorized inner loops.
+///
+/// Kernels that should benefit from wider vector instructions are compiled
+/// several times with different target attributes (see SCIPP_SIMD_TARGET_*)
+/// and one of the variants is selected at runtime based on `simd::level()`.
+/// On compilers or architectures without support for target attributes only
+/// the default variant exists and `level()` always returns `Level::Default`.
+#pragma once
+
+#include "scipp-core_export.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) &&                              \
+    (defined(__x86_64__) || defined(__i386__))
+#define SCIPP_SIMD_DISPATCH
+#define SCIPP_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#define SCIPP_SIMD_TARGET_AVX512                                               \
+  __attribute__((target("avx512f,avx512dq,avx512vl,avx2")))
+#define SCIPP_SIMD_INLINE inline __attribute__((always_inline))
+#else
+#define SCIPP_SIMD_INLINE inline
+#endif
+
+namespace scipp::core::simd {
+
+/// Instruction-set level used for vectorized kernels. Levels are ordered, each
+/// level implies support for all lower levels. `Default` corresponds to the
+/// baseline the library was compiled for, i.e., SSE2 on x86-64.
+enum class Level { Default, AVX2, AVX512 };
+
+/// Highest level supported by the CPU running the process.
+[[nodiscard]] SCIPP_CORE_EXPORT Level detected_level() noexcept;
+/// Level currently used for dispatching vectorized kernels.
+[[nodiscard]] SCIPP_CORE_EXPORT Level level() noexcept;
+/// Limit the level used for dispatching vectorized kernels.
+///
+/// Levels exceeding the detected level are ignored. This is mainly intended for
+/// testing and for working around issues such as frequency throttling with
+/// AVX-512 on some CPUs.
+SCIPP_CORE_EXPORT void set_max_level(Level max) noexcept;
+
+} // namespace scipp::core::simd
@@ -29,8 +29,14 @@ public:
   scipp::index sum() const;
   void trim_to(const SubbinSizes &other);
   SubbinSizes &add_intersection(const SubbinSizes &other);
+  /// Step of an exclusive scan with `*this` as running sum. Sets `x` to the
+  /// sum of previous steps, restricted to the range of `x`.
+  void exclusive_scan(SubbinSizes &x);
 
 private:
+  template <class Op> SubbinSizes &accumulate(const SubbinSizes &other, Op op);
+  void shift_to(const scipp::index offset, const scipp::index length);
+
   scipp::index m_offset{0};
   container_type m_sizes;
 };
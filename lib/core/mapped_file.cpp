@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include "scipp/core/mapped_file.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace scipp::core {
+
+namespace {
+[[noreturn]] void throw_system_error(const std::string &what,
+                                     const std::string &path) {
+  throw std::runtime_error(what + " '" + path + "': " + std::strerror(errno));
+}
+} // namespace
+
+#ifdef _WIN32
+MappedFile::MappedFile(const std::string &path, const MapMode mode)
+    : m_path(path), m_mode(mode) {
+  throw std::runtime_error(
+      "Memory-mapped files are not supported on this platform.");
+}
+
+MappedFile::~MappedFile() = default;
+#else
+MappedFile::MappedFile(const std::string &path, const MapMode mode)
+    : m_path(path), m_mode(mode) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw_system_error("Failed to open", path);
+  struct stat info {};
+  if (::fstat(fd, &info) != 0) {
+    const auto error = errno;
+    ::close(fd);
+    errno = error;
+    throw_system_error("Failed to stat", path);
+  }
+  m_size = info.st_size;
+  if (m_size > 0) {
+    const int prot =
+        mode == MapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+    const int flags = mode == MapMode::ReadOnly ? MAP_SHARED : MAP_PRIVATE;
+    void *ptr = ::mmap(nullptr, m_size, prot, flags, fd, 0);
+    if (ptr == MAP_FAILED) {
+      const auto error = errno;
+      ::close(fd);
+      errno = error;
+      throw_system_error("Failed to map", path);
+    }
+    m_data = static_cast<std::byte *>(ptr);
+  }
+  // The mapping stays valid after closing the file descriptor.
+  ::close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (m_data)
+    ::munmap(m_data, m_size);
+}
+#endif
+
+} // namespace scipp::core
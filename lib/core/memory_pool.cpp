@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "scipp/core/memory_pool.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace scipp::core {
+
+namespace {
+constexpr size_t min_class = 6; // 64 bytes
+constexpr size_t max_class = std::bit_width(MemoryPool::max_pooled_size - 1);
+constexpr size_t n_class = max_class - min_class + 1;
+/// Marks blocks that are not pooled, i.e., above the maximum pooled size.
+constexpr uint32_t unpooled = UINT32_MAX;
+
+static_assert(MemoryPool::max_pooled_size == size_t{1} << max_class);
+
+/// Stored in front of every block. Padded to preserve alignment.
+struct alignas(MemoryPool::alignment) Header {
+  uint32_t size_class;
+};
+
+constexpr size_t class_bytes(const size_t cls) noexcept {
+  return size_t{1} << cls;
+}
+
+size_t size_class(const size_t size) noexcept {
+  return size <= class_bytes(min_class) ? min_class : std::bit_width(size - 1);
+}
+
+void *system_allocate(const size_t bytes,
+                      const size_t align = MemoryPool::alignment) {
+  void *ptr = nullptr;
+  if (posix_memalign(&ptr, align, bytes) != 0)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+/// Allocate a block aligned to and padded to a multiple of the huge page size
+/// and request transparent huge pages for it. This is only advice, failure is
+/// ignored, e.g., if THP is disabled on the system.
+void *allocate_huge(const size_t bytes) {
+  constexpr auto page = MemoryPool::huge_page_size;
+  const auto padded = (bytes + page - 1) / page * page;
+  void *ptr = system_allocate(padded, page);
+#ifdef MADV_HUGEPAGE
+  madvise(ptr, padded, MADV_HUGEPAGE);
+#endif
+  return ptr;
+}
+
+void system_deallocate(void *ptr) noexcept {
+#ifdef _WIN32
+  _aligned_free(ptr);
+#else
+  free(ptr);
+#endif
+}
+
+using FreeLists = std::array<std::vector<Header *>, n_class>;
+
+std::atomic<bool> pool_enabled{true};
+
+/// Cache shared by all threads. Intentionally leaked, such that blocks can be
+/// freed safely during destruction of static objects.
+struct SharedCache {
+  std::mutex mutex;
+  FreeLists blocks;
+  size_t bytes{0};
+
+  Header *pop(const size_t cls) {
+    const std::lock_guard lock(mutex);
+    auto &list = blocks[cls - min_class];
+    if (list.empty())
+      return nullptr;
+    auto *block = list.back();
+    list.pop_back();
+    bytes -= class_bytes(cls);
+    return block;
+  }
+
+  bool push(Header *block, const size_t cls) noexcept {
+    const std::lock_guard lock(mutex);
+    if (bytes + class_bytes(cls) > MemoryPool::shared_cache_limit)
+      return false;
+    try {
+      blocks[cls - min_class].push_back(block);
+    } catch (const std::bad_alloc &) {
+      return false;
+    }
+    bytes += class_bytes(cls);
+    return true;
+  }
+
+  void trim() noexcept {
+    const std::lock_guard lock(mutex);
+    for (auto &list : blocks) {
+      for (auto *block : list)
+        system_deallocate(block);
+      list.clear();
+      list.shrink_to_fit();
+    }
+    bytes = 0;
+  }
+};
+
+SharedCache &shared_cache() {
+  static auto *cache = new SharedCache;
+  return *cache;
+}
+
+bool push_shared(Header *block, const size_t cls) noexcept {
+  return shared_cache().push(block, cls);
+}
+
+/// Lifetime of the cache of the current thread. Must be trivially
+/// destructible, such that it can be checked after the cache was destroyed.
+enum class CacheState : uint8_t { Uninitialized, Alive, Destroyed };
+thread_local CacheState thread_cache_state = CacheState::Uninitialized;
+
+struct ThreadCache;
+
+/// Caches of all live threads, such that `trim` can release blocks cached by
+/// other threads, e.g., idle TBB workers. Intentionally leaked like the shared
+/// cache. Lock order is registry before cache.
+struct Registry {
+  std::mutex mutex;
+  std::vector<ThreadCache *> caches;
+};
+
+Registry &registry() {
+  static auto *r = new Registry;
+  return *r;
+}
+
+/// Cache of a single thread. Only the owning thread pushes and pops, the
+/// mutex is thus uncontended unless another thread trims or queries the size.
+struct ThreadCache {
+  std::mutex mutex;
+  FreeLists blocks;
+  size_t bytes{0};
+
+  ThreadCache() noexcept {
+    auto &r = registry();
+    const std::lock_guard lock(r.mutex);
+    try {
+      r.caches.push_back(this);
+    } catch (const std::bad_alloc &) {
+      // Unregistered caches are still trimmed when their thread exits.
+    }
+    thread_cache_state = CacheState::Alive;
+  }
+  ~ThreadCache() {
+    thread_cache_state = CacheState::Destroyed;
+    {
+      auto &r = registry();
+      const std::lock_guard lock(r.mutex);
+      std::erase(r.caches, this);
+    }
+    for (size_t i = 0; i < n_class; ++i)
+      for (auto *block : blocks[i])
+        if (!push_shared(block, i + min_class))
+          system_deallocate(block);
+  }
+
+  Header *pop(const size_t cls) noexcept {
+    const std::lock_guard lock(mutex);
+    auto &list = blocks[cls - min_class];
+    if (list.empty())
+      return nullptr;
+    auto *block = list.back();
+    list.pop_back();
+    bytes -= class_bytes(cls);
+    return block;
+  }
+
+  bool push(Header *block, const size_t cls) noexcept {
+    const std::lock_guard lock(mutex);
+    if (bytes + class_bytes(cls) > MemoryPool::thread_cache_limit)
+      return false;
+    try {
+      blocks[cls - min_class].push_back(block);
+    } catch (const std::bad_alloc &) {
+      return false;
+    }
+    bytes += class_bytes(cls);
+    return true;
+  }
+
+  void trim() noexcept {
+    const std::lock_guard lock(mutex);
+    for (auto &list : blocks) {
+      for (auto *block : list)
+        system_deallocate(block);
+      list.clear();
+    }
+    bytes = 0;
+  }
+};
+
+/// Return the cache of the calling thread, or nullptr if it was destroyed
+/// since the thread is exiting.
+ThreadCache *thread_cache() {
+  if (thread_cache_state == CacheState::Destroyed)
+    return nullptr;
+  thread_local ThreadCache cache;
+  return &cache;
+}
+
+void *to_user(Header *block) noexcept { return block + 1; }
+Header *to_block(void *ptr) noexcept { return static_cast<Header *>(ptr) - 1; }
+} // namespace
+
+void *MemoryPool::allocate(const size_t size) const {
+  if (size > max_pooled_size) {
+    auto *block = static_cast<Header *>(allocate_huge(sizeof(Header) + size));
+    block->size_class = unpooled;
+    return to_user(block);
+  }
+  const auto cls = size_class(size);
+  Header *block = nullptr;
+  if (enabled()) {
+    if (auto *cache = thread_cache())
+      block = cache->pop(cls);
+    if (!block)
+      block = shared_cache().pop(cls);
+  }
+  if (!block)
+    block = static_cast<Header *>(
+        system_allocate(sizeof(Header) + class_bytes(cls)));
+  block->size_class = static_cast<uint32_t>(cls);
+  return to_user(block);
+}
+
+void MemoryPool::deallocate(void *ptr) const noexcept {
+  if (!ptr)
+    return;
+  auto *block = to_block(ptr);
+  const auto cls = block->size_class;
+  if (cls != unpooled && enabled()) {
+    if (auto *cache = thread_cache(); cache && cache->push(block, cls))
+      return;
+    if (shared_cache().push(block, cls))
+      return;
+  }
+  system_deallocate(block);
+}
+
+void MemoryPool::set_enabled(const bool enabled) const noexcept {
+  pool_enabled = enabled;
+  if (!enabled)
+    trim();
+}
+
+bool MemoryPool::enabled() const noexcept { return pool_enabled; }
+
+void MemoryPool::trim() const noexcept {
+  {
+    auto &r = registry();
+    const std::lock_guard lock(r.mutex);
+    for (auto *cache : r.caches)
+      cache->trim();
+  }
+  shared_cache().trim();
+}
+
+size_t MemoryPool::cached_bytes() const noexcept {
+  size_t bytes = 0;
+  {
+    auto &r = registry();
+    const std::lock_guard lock(r.mutex);
+    for (auto *cache : r.caches) {
+      const std::lock_guard cache_lock(cache->mutex);
+      bytes += cache->bytes;
+    }
+  }
+  auto &shared = shared_cache();
+  const std::lock_guard lock(shared.mutex);
+  return bytes + shared.bytes;
+}
+
+MemoryPool &instance() {
+  static MemoryPool pool;
+  return pool;
+}
+
+} // namespace scipp::core
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include "scipp/core/memory_usage.h"
+
+namespace scipp::core {
+
+namespace {
+std::atomic<scipp::index> current_bytes{0};
+std::atomic<scipp::index> peak_bytes{0};
+std::atomic<scipp::index> allocations{0};
+
+struct DTypeBytes {
+  std::mutex mutex;
+  std::unordered_map<DType, scipp::index> bytes;
+};
+
+/// Intentionally leaked, such that records in static objects can be destroyed
+/// safely.
+DTypeBytes &dtype_bytes() {
+  static auto *bytes = new DTypeBytes;
+  return *bytes;
+}
+} // namespace
+
+MemoryStats memory_stats() noexcept {
+  return {current_bytes.load(std::memory_order_relaxed),
+          peak_bytes.load(std::memory_order_relaxed),
+          allocations.load(std::memory_order_relaxed)};
+}
+
+void reset_peak_memory() noexcept {
+  peak_bytes.store(current_bytes.load(std::memory_order_relaxed),
+                   std::memory_order_relaxed);
+}
+
+std::map<DType, scipp::index> memory_by_dtype() {
+  auto &stats = dtype_bytes();
+  const std::lock_guard lock(stats.mutex);
+  std::map<DType, scipp::index> out;
+  for (const auto &[dtype, bytes] : stats.bytes)
+    if (bytes != 0)
+      out.emplace(dtype, bytes);
+  return out;
+}
+
+namespace detail {
+void record_allocation(const scipp::index bytes) noexcept {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  const auto current =
+      current_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  auto peak = peak_bytes.load(std::memory_order_relaxed);
+  while (current > peak &&
+         !peak_bytes.compare_exchange_weak(peak, current,
+                                           std::memory_order_relaxed)) {
+  }
+}
+
+void record_deallocation(const scipp::index bytes) noexcept {
+  current_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void record_dtype_bytes(const DType dtype, const scipp::index delta) noexcept {
+  auto &stats = dtype_bytes();
+  const std::lock_guard lock(stats.mutex);
+  try {
+    stats.bytes[dtype] += delta;
+  } catch (const std::bad_alloc &) {
+    // Statistics are best effort, do not fail if the map cannot grow.
+  }
+}
+} // namespace detail
+
+} // namespace scipp::core
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+
+#include "scipp/core/parallel.h"
+
+namespace scipp::core::parallel {
+
+namespace {
+std::mutex arena_mutex;
+std::shared_ptr<tbb::task_arena> shared_arena;
+std::atomic<scipp::index> shared_arena_concurrency{0};
+std::atomic<bool> shared_arena_is_default{true};
+thread_local scipp::index parallel_depth = 0;
+
+int default_max_threads() {
+#ifdef ENABLE_THREAD_LIMIT
+  return THREAD_LIMIT;
+#else
+  return tbb::task_arena::automatic;
+#endif
+}
+
+/// Create and initialize an arena. Initializing is cheap and required for
+/// querying the actual concurrency of an arena with `automatic` concurrency.
+/// Must be called with `arena_mutex` held.
+std::shared_ptr<tbb::task_arena> make_arena(const int concurrency) {
+  auto arena = std::make_shared<tbb::task_arena>(concurrency);
+  arena->initialize();
+  shared_arena_concurrency = arena->max_concurrency();
+  return arena;
+}
+
+void replace_arena(const int concurrency, const bool is_default) {
+  if (detail::in_parallel())
+    throw std::runtime_error(
+        "Cannot change the number of threads from within a parallel task.");
+  const std::lock_guard lock(arena_mutex);
+  shared_arena = make_arena(concurrency);
+  shared_arena_is_default = is_default;
+}
+} // namespace
+
+namespace detail {
+std::shared_ptr<tbb::task_arena> arena() {
+  const std::lock_guard lock(arena_mutex);
+  if (!shared_arena)
+    shared_arena = make_arena(default_max_threads());
+  return shared_arena;
+}
+
+bool in_parallel() noexcept { return parallel_depth > 0; }
+
+ParallelScope::ParallelScope() noexcept { ++parallel_depth; }
+ParallelScope::~ParallelScope() noexcept { --parallel_depth; }
+} // namespace detail
+
+scipp::index max_threads() noexcept {
+  if (const auto n = shared_arena_concurrency.load(); n > 0)
+    return n;
+  try {
+    return detail::arena()->max_concurrency();
+  } catch (...) {
+    return 1;
+  }
+}
+
+void set_max_threads(const scipp::index n) {
+  if (n < 1)
+    throw std::invalid_argument("Number of threads must be at least 1.");
+  replace_arena(static_cast<int>(n), false);
+}
+
+void reset_max_threads() { replace_arena(default_max_threads(), true); }
+
+bool max_threads_is_default() noexcept { return shared_arena_is_default; }
+
+} // namespace scipp::core::parallel
@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+#include "scipp/core/profiler.h"
+
+namespace scipp::core::profiler {
+
+namespace {
+using clock = std::chrono::steady_clock;
+
+struct Event {
+  std::string name;
+  clock::time_point start;
+  double seconds;
+  scipp::index thread;
+  scipp::index elements;
+};
+
+struct Recorder {
+  std::mutex mutex;
+  std::unordered_map<std::string, OpStats> stats;
+  std::vector<Event> events;
+  std::unordered_map<std::thread::id, scipp::index> threads;
+  clock::time_point epoch{clock::now()};
+
+  scipp::index thread_index(const std::thread::id id) {
+    return threads.try_emplace(id, scipp::size(threads)).first->second;
+  }
+};
+
+std::atomic<bool> profiler_enabled{false};
+
+/// Intentionally leaked, such that scopes in static objects can be destroyed
+/// safely.
+Recorder &recorder() {
+  static auto *rec = new Recorder;
+  return *rec;
+}
+
+thread_local Scope *current_scope = nullptr;
+
+/// Escape a string for use in JSON.
+std::string escape(const std::string_view s) {
+  std::string out;
+  for (const char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      std::ostringstream hex;
+      hex << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+          << static_cast<int>(c);
+      out += hex.str();
+    } else {
+      out += c;
+    }
+  }
+  return out;
+}
+} // namespace
+
+void set_enabled(const bool enabled) {
+  if (enabled)
+    recorder(); // create before the first scope, such that it sets the epoch
+  profiler_enabled = enabled;
+}
+
+bool enabled() noexcept {
+  return profiler_enabled.load(std::memory_order_relaxed);
+}
+
+void reset() {
+  auto &rec = recorder();
+  const std::lock_guard lock(rec.mutex);
+  rec.stats.clear();
+  rec.events.clear();
+  rec.epoch = clock::now();
+}
+
+std::vector<OpStats> stats() {
+  auto &rec = recorder();
+  std::vector<OpStats> out;
+  {
+    const std::lock_guard lock(rec.mutex);
+    for (const auto &item : rec.stats)
+      out.push_back(item.second);
+  }
+  std::sort(out.begin(), out.end(), [](const auto &a, const auto &b) {
+    return a.seconds > b.seconds;
+  });
+  return out;
+}
+
+std::string summary() {
+  std::ostringstream os;
+  os << std::left << std::setw(48) << "operation" << std::right
+     << std::setw(8) << "calls" << std::setw(12) << "time [s]"
+     << std::setw(14) << "elements" << std::setw(10) << "GB/s"
+     << std::setw(9) << "threads" << std::setw(24) << "vector/special/generic"
+     << '\n';
+  os << std::fixed;
+  for (const auto &op : stats()) {
+    const double bytes = static_cast<double>(op.bytes_read + op.bytes_written);
+    const double bandwidth = op.seconds > 0.0 ? bytes / op.seconds * 1e-9 : 0.0;
+    std::ostringstream loops;
+    loops << op.vectorized_chunks << '/' << op.specialized_chunks << '/'
+          << op.generic_chunks;
+    os << std::left << std::setw(48) << op.name << std::right << std::setw(8)
+       << op.calls << std::setw(12) << std::setprecision(6) << op.seconds
+       << std::setw(14) << op.elements << std::setw(10)
+       << std::setprecision(2) << bandwidth << std::setw(9) << op.max_threads
+       << std::setw(24) << loops.str() << '\n';
+  }
+  return os.str();
+}
+
+std::string chrome_trace() {
+  auto &rec = recorder();
+  std::ostringstream os;
+  os << "{\"traceEvents\":[";
+  const std::lock_guard lock(rec.mutex);
+  bool first = true;
+  for (const auto &event : rec.events) {
+    const auto start = std::chrono::duration<double, std::micro>(
+                           event.start - rec.epoch)
+                           .count();
+    os << (first ? "" : ",") << "\n{\"name\":\"" << escape(event.name)
+       << "\",\"cat\":\"scipp\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+       << event.thread << ",\"ts\":" << std::fixed << std::setprecision(3)
+       << start << ",\"dur\":" << event.seconds * 1e6
+       << ",\"args\":{\"elements\":" << event.elements << "}}";
+    first = false;
+  }
+  os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+  return os.str();
+}
+
+Scope::Scope(const std::string_view name) : m_active(enabled()), m_name(name) {
+  if (!m_active)
+    return;
+  m_parent = current_scope;
+  current_scope = this;
+  m_start = clock::now();
+}
+
+Scope::~Scope() {
+  if (!m_active)
+    return;
+  const auto end = clock::now();
+  current_scope = m_parent;
+  const auto seconds = std::chrono::duration<double>(end - m_start).count();
+  const auto threads = std::max(scipp::size(m_threads), scipp::index{1});
+  auto &rec = recorder();
+  try {
+    const std::lock_guard lock(rec.mutex);
+    auto &op = rec.stats[std::string(m_name)];
+    op.name = m_name;
+    ++op.calls;
+    op.seconds += seconds;
+    op.elements += m_elements;
+    op.bytes_read += m_bytes_read;
+    op.bytes_written += m_bytes_written;
+    op.max_threads = std::max(op.max_threads, threads);
+    op.vectorized_chunks += m_loops[static_cast<int>(Loop::Vectorized)];
+    op.specialized_chunks += m_loops[static_cast<int>(Loop::Specialized)];
+    op.generic_chunks += m_loops[static_cast<int>(Loop::Generic)];
+    if (scipp::size(rec.events) < max_events)
+      rec.events.push_back({op.name, m_start, seconds,
+                            rec.thread_index(std::this_thread::get_id()),
+                            m_elements});
+  } catch (const std::bad_alloc &) {
+    // Profiling is best effort, do not fail if recording fails.
+  }
+}
+
+void Scope::add_task(const TaskStats &task) noexcept {
+  m_elements.fetch_add(task.elements, std::memory_order_relaxed);
+  m_bytes_read.fetch_add(task.bytes_read, std::memory_order_relaxed);
+  m_bytes_written.fetch_add(task.bytes_written, std::memory_order_relaxed);
+  for (size_t i = 0; i < task.chunks.size(); ++i)
+    m_loops[i].fetch_add(task.chunks[i], std::memory_order_relaxed);
+  const auto id = std::this_thread::get_id();
+  const std::lock_guard lock(m_threads_mutex);
+  if (std::find(m_threads.begin(), m_threads.end(), id) != m_threads.end())
+    return;
+  try {
+    m_threads.push_back(id);
+  } catch (const std::bad_alloc &) {
+    // Profiling is best effort, see destructor.
+  }
+}
+
+Scope *current() noexcept { return current_scope; }
+
+Attach::Attach(Scope *scope) noexcept : m_previous(current_scope) {
+  current_scope = scope;
+}
+
+Attach::~Attach() { current_scope = m_previous; }
+
+} // namespace scipp::core::profiler
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+#include <algorithm>
+#include <atomic>
+
+#include "scipp/core/simd.h"
+
+namespace scipp::core::simd {
+
+namespace {
+Level detect() noexcept {
+#ifdef SCIPP_SIMD_DISPATCH
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") &&
+      __builtin_cpu_supports("avx512vl"))
+    return Level::AVX512;
+  if (__builtin_cpu_supports("avx2"))
+    return Level::AVX2;
+#endif
+  return Level::Default;
+}
+
+std::atomic<Level> &active_level() noexcept {
+  static std::atomic<Level> level{detected_level()};
+  return level;
+}
+} // namespace
+
+Level detected_level() noexcept {
+  static const Level level = detect();
+  return level;
+}
+
+Level level() noexcept {
+  return active_level().load(std::memory_order_relaxed);
+}
+
+void set_max_level(const Level max) noexcept {
+  active_level().store(std::min(max, detected_level()),
+                       std::memory_order_relaxed);
+}
+
+} // namespace scipp::core::simd
@@ -4,6 +4,8 @@
 /// @author Simon Heybrock
 #include <algorithm>
 #include <numeric>
+#include <span>
+#include <utility>
 
 #include "scipp/common/except.h"
 #include "scipp/core/element/arithmetic.h"
@@ -26,20 +28,59 @@ void SubbinSizes::operator=(const scipp::index value) {
     size = value;
 }
 
-SubbinSizes &SubbinSizes::operator+=(const SubbinSizes &other) {
+namespace {
+template <class Op>
+SubbinSizes binary(const SubbinSizes &a, const SubbinSizes &b, Op op) {
+  const auto begin = std::min(a.offset(), b.offset());
+  const auto end =
+      std::max(a.offset() + a.sizes().size(), b.offset() + b.sizes().size());
+  typename SubbinSizes::container_type sizes(end - begin);
+  scipp::index current = a.offset() - begin;
+  for (const auto &size : a.sizes())
+    sizes[current++] += size;
+  current = b.offset() - begin;
+  for (const auto &size : b.sizes())
+    op(sizes[current++], size);
+  return {begin, std::move(sizes)};
+}
+
+/// Apply `op` to the elements of `a` and `b` at the same full index, for the
+/// intersection of their ranges.
+template <class Op>
+void for_each_intersection(std::span<scipp::index> a,
+                           const scipp::index a_offset,
+                           std::span<const scipp::index> b,
+                           const scipp::index b_offset, Op op) {
+  const auto begin = std::max(a_offset, b_offset);
+  const auto end =
+      std::min(a_offset + scipp::size(a), b_offset + scipp::size(b));
+  if (end <= begin)
+    return;
+  // Plain loop over raw pointers to allow for vectorization.
+  auto *out = a.data() + (begin - a_offset);
+  const auto *in = b.data() + (begin - b_offset);
+  for (scipp::index i = 0; i < end - begin; ++i)
+    op(out[i], in[i]);
+}
+} // namespace
+
+template <class Op>
+SubbinSizes &SubbinSizes::accumulate(const SubbinSizes &other, Op op) {
   if (other.offset() < offset()) // avoid realloc if possible
-    return *this = *this + other;
-  scipp::index current = other.offset() - offset();
-  const auto length = current + scipp::size(other.sizes());
+    return *this = binary(*this, other, op);
+  const auto length = other.offset() - offset() + scipp::size(other.sizes());
   if (length > scipp::size(sizes()))
     m_sizes.resize(length);
-  for (const auto &x : other.sizes())
-    m_sizes[current++] += x;
+  for_each_intersection(m_sizes, offset(), other.sizes(), other.offset(), op);
   return *this;
 }
 
+SubbinSizes &SubbinSizes::operator+=(const SubbinSizes &other) {
+  return accumulate(other, element::add_equals);
+}
+
 SubbinSizes &SubbinSizes::operator-=(const SubbinSizes &other) {
-  return *this = *this - other;
+  return accumulate(other, element::subtract_equals);
 }
 
 SubbinSizes SubbinSizes::cumsum_exclusive() const {
@@ -54,49 +95,55 @@ scipp::index SubbinSizes::sum() const {
   return std::accumulate(sizes().begin(), sizes().end(), scipp::index{0});
 }
 
+/// Move the values of the intersection with the range of `offset` and
+/// `length` to their new position, zeroing all other values. Does not
+/// allocate unless the new range is longer than the current one.
+void SubbinSizes::shift_to(const scipp::index offset,
+                           const scipp::index length) {
+  const auto old_length = scipp::size(m_sizes);
+  const auto delta = offset - m_offset;
+  if (length > old_length)
+    m_sizes.resize(length);
+  const auto value = [&](const scipp::index i) {
+    const auto j = i + delta;
+    return j >= 0 && j < old_length ? m_sizes[j] : scipp::index{0};
+  };
+  // Values move towards the front if delta > 0, to the back otherwise, so the
+  // iteration order ensures that every value is read before being overwritten.
+  if (delta >= 0)
+    for (scipp::index i = 0; i < length; ++i)
+      m_sizes[i] = value(i);
+  else
+    for (scipp::index i = length - 1; i >= 0; --i)
+      m_sizes[i] = value(i);
+  m_sizes.resize(length);
+  m_offset = offset;
+}
+
 void SubbinSizes::trim_to(const SubbinSizes &other) {
-  auto out = other; // TODO in principle this allocation could be avoided, but
-                    // initial implementation attempts got messy.
-  out = 0;
-  // full index begin/end
-  const auto begin = std::max(offset(), out.offset());
-  const auto end = std::min(offset() + scipp::size(sizes()),
-                            out.offset() + scipp::size(out.sizes()));
-  const auto ibegin =
-      sizes().begin() + std::max(begin - offset(), scipp::index(0));
-  const auto obegin =
-      out.m_sizes.begin() + std::max(begin - out.offset(), scipp::index(0));
-  std::copy_n(ibegin, std::max(scipp::index(0), end - begin), obegin);
-  *this = std::move(out);
+  shift_to(other.offset(), scipp::size(other.sizes()));
 }
 
 SubbinSizes &SubbinSizes::add_intersection(const SubbinSizes &other) {
-  scipp::index delta = other.offset() - offset();
-  auto i = std::max(scipp::index(0), delta);
-  auto j = std::max(scipp::index(0), -delta);
-  for (; j < scipp::size(other.sizes()) && i < scipp::size(sizes()); ++j, ++i) {
-    m_sizes[i] += other.sizes()[j];
-  }
+  for_each_intersection(m_sizes, offset(), other.sizes(), other.offset(),
+                        element::add_equals);
   return *this;
 }
 
-bool operator==(const SubbinSizes &a, const SubbinSizes &b) {
-  return (a.offset() == b.offset()) && (a.sizes() == b.sizes());
+void SubbinSizes::exclusive_scan(SubbinSizes &x) {
+  trim_to(x);
+  // Equivalent to `*this += x; x = *this - x;`, without allocation.
+  auto *sum = m_sizes.data();
+  auto *out = x.m_sizes.data();
+  for (scipp::index i = 0; i < scipp::size(m_sizes); ++i) {
+    const auto previous = sum[i];
+    sum[i] += out[i];
+    out[i] = previous;
+  }
 }
 
-template <class Op>
-SubbinSizes binary(const SubbinSizes &a, const SubbinSizes &b, Op op) {
-  const auto begin = std::min(a.offset(), b.offset());
-  const auto end =
-      std::max(a.offset() + a.sizes().size(), b.offset() + b.sizes().size());
-  typename SubbinSizes::container_type sizes(end - begin);
-  scipp::index current = a.offset() - begin;
-  for (const auto &size : a.sizes())
-    sizes[current++] += size;
-  current = b.offset() - begin;
-  for (const auto &size : b.sizes())
-    op(sizes[current++], size);
-  return {begin, std::move(sizes)};
+bool operator==(const SubbinSizes &a, const SubbinSizes &b) {
+  return (a.offset() == b.offset()) && (a.sizes() == b.sizes());
 }
 
 SubbinSizes operator+(const SubbinSizes &a, const SubbinSizes &b) {
@@ -180,3 +180,29 @@ TEST(ElementArrayTest, resize_default_init) {
   x.resize(0, init_for_overwrite);
   check_empty_element_array(x);
 }
+
+TEST(ElementArrayTest, single_element_is_stored_inline) {
+  const auto allocations = scipp::core::memory_stats().allocations;
+  element_array<double> x(1, 1.5);
+  ASSERT_EQ(scipp::core::memory_stats().allocations, allocations);
+  ASSERT_EQ(x.size(), 1);
+  ASSERT_NE(x.data(), nullptr);
+  ASSERT_EQ(x.data()[0], 1.5);
+  auto y(std::move(x));
+  check_null_element_array(x);
+  ASSERT_EQ(y.data()[0], 1.5);
+  auto z(y);
+  z.data()[0] = 2.5;
+  ASSERT_EQ(y.data()[0], 1.5);
+  ASSERT_EQ(z.data()[0], 2.5);
+}
+
+TEST(ElementArrayTest, resize_between_inline_and_allocated) {
+  element_array<double> x(1, 1.5);
+  x.resize(3);
+  ASSERT_EQ(x.size(), 3);
+  ASSERT_EQ(x.data()[2], 0.0);
+  x.resize(1);
+  ASSERT_EQ(x.size(), 1);
+  ASSERT_EQ(x.data()[0], 0.0);
+}
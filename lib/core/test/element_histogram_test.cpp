@@ -63,3 +63,34 @@ TEST(ElementHistogramTest, no_variance) {
                      edges);
   EXPECT_EQ(result_vals, std::vector<double>({20 + 30, 40 + 50}));
 }
+
+TEST(ElementHistogramTest, logspace) {
+  std::vector<double> edges{1, 2, 4, 8};
+  std::vector<double> events{0.5, 1, 1.5, 2, 3.999, 4, 7.5, 8, 9};
+  std::vector<double> weights(events.size(), 1.0);
+  std::vector<double> result{0, 0, 0};
+  element::histogram_logspace(std::span(result), events, std::span(weights),
+                              edges);
+  EXPECT_EQ(result, std::vector<double>({2, 2, 2}));
+}
+
+TEST(ElementHistogramTest, sorted_edges_many_events) {
+  // Enough events per edge to use SortedEdgeLookup.
+  std::vector<double> edges{-1.0, 0.0, 0.1, 0.15, 2.0, 10.0};
+  std::vector<double> events;
+  for (int i = -200; i < 1200; ++i)
+    events.push_back(0.01 * i);
+  for (const auto edge : edges)
+    events.push_back(edge);
+  std::vector<double> weights(events.size(), 1.0);
+  std::vector<double> result(edges.size() - 1);
+  element::histogram_sorted_edges(std::span(result), events,
+                                  std::span(weights), edges);
+  std::vector<double> expected(edges.size() - 1);
+  for (const auto x : events) {
+    const auto it = std::upper_bound(edges.begin(), edges.end(), x);
+    if (it != edges.begin() && it != edges.end())
+      ++expected[std::distance(edges.begin(), it) - 1];
+  }
+  EXPECT_EQ(result, expected);
+}
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "scipp/core/group_map.h"
+#include "scipp/core/time_point.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+template <class T> class GroupMapTest : public ::testing::Test {};
+using GroupMapTestTypes = ::testing::Types<int64_t, int32_t>;
+TYPED_TEST_SUITE(GroupMapTest, GroupMapTestTypes);
+
+TYPED_TEST(GroupMapTest, empty) {
+  const std::vector<TypeParam> labels;
+  const GroupMap<TypeParam, int64_t> map(labels);
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_EQ(map.find(0), -1);
+}
+
+TYPED_TEST(GroupMapTest, dense) {
+  const std::vector<TypeParam> labels{13, 11, 10, 14};
+  const GroupMap<TypeParam, int64_t> map(labels);
+  EXPECT_EQ(map.size(), 4);
+  EXPECT_EQ(map.find(13), 0);
+  EXPECT_EQ(map.find(11), 1);
+  EXPECT_EQ(map.find(10), 2);
+  EXPECT_EQ(map.find(14), 3);
+  EXPECT_EQ(map.find(12), -1);
+  EXPECT_EQ(map.find(9), -1);
+  EXPECT_EQ(map.find(15), -1);
+  EXPECT_EQ(map.find(-1), -1);
+  EXPECT_EQ(map.find(std::numeric_limits<TypeParam>::min()), -1);
+  EXPECT_EQ(map.find(std::numeric_limits<TypeParam>::max()), -1);
+}
+
+TYPED_TEST(GroupMapTest, sparse) {
+  const auto max = std::numeric_limits<TypeParam>::max();
+  const auto min = std::numeric_limits<TypeParam>::min();
+  const std::vector<TypeParam> labels{max, 7, min, -100000};
+  const GroupMap<TypeParam, int32_t> map(labels);
+  EXPECT_EQ(map.find(max), 0);
+  EXPECT_EQ(map.find(7), 1);
+  EXPECT_EQ(map.find(min), 2);
+  EXPECT_EQ(map.find(-100000), 3);
+  EXPECT_EQ(map.find(0), -1);
+  EXPECT_EQ(map.find(8), -1);
+  EXPECT_EQ(map.find(max - 1), -1);
+}
+
+TYPED_TEST(GroupMapTest, duplicate_throws) {
+  const std::vector<TypeParam> dense{1, 2, 1};
+  EXPECT_THROW((GroupMap<TypeParam, int64_t>(dense)), std::runtime_error);
+  const std::vector<TypeParam> sparse{1, 1000000, 1};
+  EXPECT_THROW((GroupMap<TypeParam, int64_t>(sparse)), std::runtime_error);
+}
+
+TEST(GroupMapHashTest, string) {
+  std::vector<std::string> labels;
+  for (int i = 0; i < 100; ++i)
+    labels.emplace_back("label" + std::to_string(i));
+  const GroupMap<std::string, int64_t> map(labels);
+  for (int i = 0; i < 100; ++i)
+    EXPECT_EQ(map.find("label" + std::to_string(i)), i);
+  EXPECT_EQ(map.find("label100"), -1);
+  EXPECT_EQ(map.find(""), -1);
+}
+
+TEST(GroupMapHashTest, double) {
+  const std::vector<double> labels{1.5, -2.0, 0.0};
+  const GroupMap<double, int32_t> map(labels);
+  EXPECT_EQ(map.find(1.5), 0);
+  EXPECT_EQ(map.find(-2.0), 1);
+  EXPECT_EQ(map.find(0.0), 2);
+  EXPECT_EQ(map.find(-0.0), 2);
+  EXPECT_EQ(map.find(2.0), -1);
+}
+
+TEST(GroupMapHashTest, time_point) {
+  const std::vector<time_point> labels{time_point{5}, time_point{1}};
+  const GroupMap<time_point, int64_t> map(labels);
+  EXPECT_EQ(map.find(time_point{5}), 0);
+  EXPECT_EQ(map.find(time_point{1}), 1);
+  EXPECT_EQ(map.find(time_point{2}), -1);
+}
+
+TEST(GroupMapHashTest, duplicate_throws) {
+  const std::vector<std::string> labels{"a", "b", "a"};
+  EXPECT_THROW((GroupMap<std::string, int64_t>(labels)), std::runtime_error);
+}
+
+TEST(GroupMapHashTest, default_constructed_finds_nothing) {
+  const GroupMap<std::string, int64_t> map;
+  EXPECT_EQ(map.find("a"), -1);
+}
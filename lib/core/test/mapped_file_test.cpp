@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "scipp/core/element_array.h"
+#include "scipp/core/mapped_file.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+class MappedFileTest : public ::testing::Test {
+protected:
+  MappedFileTest() {
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(values.data()),
+               values.size() * sizeof(double));
+  }
+  ~MappedFileTest() override { std::filesystem::remove(path); }
+
+  std::vector<double> read_file() const {
+    std::vector<double> out(values.size());
+    std::ifstream file(path, std::ios::binary);
+    file.read(reinterpret_cast<char *>(out.data()),
+              out.size() * sizeof(double));
+    return out;
+  }
+
+  std::string path =
+      (std::filesystem::temp_directory_path() / "scipp_mapped_file_test.bin")
+          .string();
+  std::vector<double> values{1.0, 2.0, 3.0, 4.0};
+};
+
+TEST_F(MappedFileTest, maps_entire_file) {
+  const MappedFile file(path, MapMode::ReadOnly);
+  EXPECT_EQ(file.size(), 4 * sizeof(double));
+  EXPECT_EQ(file.path(), path);
+  EXPECT_EQ(reinterpret_cast<const double *>(file.data())[2], 3.0);
+}
+
+TEST_F(MappedFileTest, missing_file_throws) {
+  EXPECT_THROW(MappedFile(path + ".missing", MapMode::ReadOnly),
+               std::runtime_error);
+}
+
+TEST_F(MappedFileTest, element_array_refers_to_file) {
+  const auto file = std::make_shared<MappedFile>(path, MapMode::ReadOnly);
+  const element_array<double> array(file, sizeof(double), 2);
+  EXPECT_EQ(array.size(), 2);
+  EXPECT_EQ(array.mapping(), file);
+  EXPECT_EQ(reinterpret_cast<const std::byte *>(array.data()),
+            file->data() + sizeof(double));
+  EXPECT_TRUE(std::equal(array.begin(), array.end(), values.begin() + 1));
+}
+
+TEST_F(MappedFileTest, element_array_keeps_file_alive) {
+  auto file = std::make_shared<MappedFile>(path, MapMode::ReadOnly);
+  element_array<double> array(file, 0, 4);
+  file.reset();
+  EXPECT_EQ(array.data()[3], 4.0);
+  const auto mapping = array.mapping();
+  EXPECT_EQ(mapping.use_count(), 2);
+  array.reset();
+  EXPECT_EQ(mapping.use_count(), 1);
+}
+
+TEST_F(MappedFileTest, element_array_copy_is_not_mapped) {
+  const auto file = std::make_shared<MappedFile>(path, MapMode::ReadOnly);
+  const element_array<double> array(file, 0, 4);
+  const auto copy(array);
+  EXPECT_FALSE(copy.mapping());
+  EXPECT_NE(copy.data(), array.data());
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), values.begin()));
+}
+
+TEST_F(MappedFileTest, element_array_copy_on_write_leaves_file_unchanged) {
+  const auto file = std::make_shared<MappedFile>(path, MapMode::CopyOnWrite);
+  element_array<double> array(file, 0, 4);
+  array.data()[0] = 10.0;
+  EXPECT_EQ(array.data()[0], 10.0);
+  EXPECT_EQ(read_file(), values);
+}
+
+TEST_F(MappedFileTest, element_array_resize_for_overwrite_does_not_write_file) {
+  const auto file = std::make_shared<MappedFile>(path, MapMode::CopyOnWrite);
+  element_array<double> array(file, 0, 4);
+  array.resize(4, init_for_overwrite);
+  EXPECT_FALSE(array.mapping());
+}
+
+TEST_F(MappedFileTest, element_array_out_of_range_throws) {
+  const auto file = std::make_shared<MappedFile>(path, MapMode::ReadOnly);
+  EXPECT_THROW(element_array<double>(file, 0, 5), std::out_of_range);
+  EXPECT_THROW(element_array<double>(file, 8, 4), std::out_of_range);
+  EXPECT_THROW(element_array<double>(file, 1, 1), std::invalid_argument);
+}
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "scipp/core/element_array.h"
+#include "scipp/core/memory_pool.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+class MemoryPoolTest : public ::testing::Test {
+protected:
+  MemoryPoolTest() { pool.set_enabled(true); }
+  ~MemoryPoolTest() override { pool.set_enabled(true); }
+  MemoryPool &pool = instance();
+};
+
+TEST_F(MemoryPoolTest, alignment) {
+  for (const size_t size : {1, 7, 64, 100, 4096, 1 << 23}) {
+    auto *ptr = pool.allocate(size);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % MemoryPool::alignment, 0);
+    pool.deallocate(ptr);
+  }
+}
+
+TEST_F(MemoryPoolTest, deallocate_nullptr) { pool.deallocate(nullptr); }
+
+TEST_F(MemoryPoolTest, freed_block_is_reused) {
+  pool.trim();
+  auto *a = pool.allocate(1000);
+  pool.deallocate(a);
+  EXPECT_EQ(pool.cached_bytes(), 1024);
+  // Same size class
+  auto *b = pool.allocate(600);
+  EXPECT_EQ(b, a);
+  EXPECT_EQ(pool.cached_bytes(), 0);
+  pool.deallocate(b);
+}
+
+TEST_F(MemoryPoolTest, large_blocks_are_not_cached) {
+  pool.trim();
+  pool.deallocate(pool.allocate(MemoryPool::max_pooled_size + 1));
+  EXPECT_EQ(pool.cached_bytes(), 0);
+}
+
+TEST_F(MemoryPoolTest, large_blocks_are_huge_page_aligned) {
+  auto *ptr = pool.allocate(MemoryPool::max_pooled_size + 1);
+  // Block header precedes the returned pointer.
+  const auto block = reinterpret_cast<uintptr_t>(ptr) - MemoryPool::alignment;
+  EXPECT_EQ(block % MemoryPool::huge_page_size, 0);
+  pool.deallocate(ptr);
+}
+
+TEST_F(MemoryPoolTest, trim) {
+  pool.deallocate(pool.allocate(1000));
+  EXPECT_NE(pool.cached_bytes(), 0);
+  pool.trim();
+  EXPECT_EQ(pool.cached_bytes(), 0);
+}
+
+TEST_F(MemoryPoolTest, disabled) {
+  auto *a = pool.allocate(1000);
+  pool.deallocate(pool.allocate(1000));
+  pool.set_enabled(false);
+  EXPECT_FALSE(pool.enabled());
+  EXPECT_EQ(pool.cached_bytes(), 0);
+  pool.deallocate(pool.allocate(1000));
+  EXPECT_EQ(pool.cached_bytes(), 0);
+  // Blocks allocated while enabled can be freed after disabling.
+  pool.deallocate(a);
+  EXPECT_EQ(pool.cached_bytes(), 0);
+}
+
+TEST_F(MemoryPoolTest, free_on_other_thread) {
+  pool.trim();
+  auto *ptr = pool.allocate(1000);
+  std::thread([&]() { pool.deallocate(ptr); }).join();
+  // Exiting thread passes its cached blocks to the shared cache.
+  EXPECT_EQ(pool.cached_bytes(), 1024);
+  EXPECT_EQ(pool.allocate(1000), ptr);
+  pool.deallocate(ptr);
+}
+
+TEST_F(MemoryPoolTest, trim_releases_caches_of_other_threads) {
+  pool.trim();
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool cached = false;
+  bool done = false;
+  std::thread worker([&]() {
+    pool.deallocate(pool.allocate(1000));
+    std::unique_lock lock(mutex);
+    cached = true;
+    cv.notify_all();
+    cv.wait(lock, [&]() { return done; });
+  });
+  {
+    std::unique_lock lock(mutex);
+    cv.wait(lock, [&]() { return cached; });
+  }
+  EXPECT_EQ(pool.cached_bytes(), 1024);
+  pool.set_enabled(false);
+  EXPECT_EQ(pool.cached_bytes(), 0);
+  {
+    const std::lock_guard lock(mutex);
+    done = true;
+  }
+  cv.notify_all();
+  worker.join();
+  EXPECT_EQ(pool.cached_bytes(), 0);
+}
+
+TEST_F(MemoryPoolTest, element_array) {
+  pool.trim();
+  const auto *data = element_array<double>(100, 1.0).data();
+  EXPECT_EQ(pool.cached_bytes(), 1024);
+  element_array<double> array(100, 2.0);
+  EXPECT_EQ(array.data(), data);
+  EXPECT_EQ(pool.cached_bytes(), 0);
+}
+
+TEST_F(MemoryPoolTest, element_array_large_for_overwrite) {
+  const scipp::index size = MemoryPool::max_pooled_size;
+  element_array<double> array(size, init_for_overwrite);
+  ASSERT_EQ(array.size(), size);
+  array.data()[0] = 1.0;
+  array.data()[size - 1] = 2.0;
+  EXPECT_EQ(array.data()[0], 1.0);
+  EXPECT_EQ(array.data()[size - 1], 2.0);
+  element_array<double> filled(size, 3.0);
+  EXPECT_EQ(filled.data()[size - 1], 3.0);
+}
@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "scipp/core/element_array.h"
+#include "scipp/core/memory_usage.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+TEST(MemoryUsageTest, element_array_is_counted) {
+  const auto before = memory_stats();
+  {
+    element_array<double> array(1000);
+    const auto stats = memory_stats();
+    EXPECT_EQ(stats.current_bytes, before.current_bytes + 8000);
+    EXPECT_EQ(stats.allocations, before.allocations + 1);
+    EXPECT_GE(stats.peak_bytes, stats.current_bytes);
+  }
+  EXPECT_EQ(memory_stats().current_bytes, before.current_bytes);
+}
+
+TEST(MemoryUsageTest, reset_peak) {
+  { element_array<double> array(1000); }
+  reset_peak_memory();
+  const auto stats = memory_stats();
+  EXPECT_EQ(stats.peak_bytes, stats.current_bytes);
+  { element_array<double> array(1000); }
+  EXPECT_EQ(memory_stats().peak_bytes, stats.current_bytes + 8000);
+}
+
+TEST(MemoryUsageTest, dtype_record) {
+  const auto bytes = [] {
+    const auto stats = memory_by_dtype();
+    const auto it = stats.find(dtype<float>);
+    return it == stats.end() ? 0 : it->second;
+  };
+  const auto before = bytes();
+  {
+    DTypeMemoryRecord record(dtype<float>);
+    record.set(100);
+    EXPECT_EQ(bytes(), before + 100);
+    const auto copy = record;
+    EXPECT_EQ(bytes(), before + 200);
+    record.set(10);
+    EXPECT_EQ(bytes(), before + 110);
+  }
+  EXPECT_EQ(bytes(), before);
+}
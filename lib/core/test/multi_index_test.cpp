@@ -435,3 +435,60 @@ TEST_F(MultiIndexTest, two_1d_arrays_of_1d_bins_bin_size_mismatch) {
                                {0, 1, 2, 3, 4, 5, 6}),
                except::BinnedDataError);
 }
+
+TEST_F(MultiIndexTest, cumulative_bin_sizes) {
+  const Dim dim = Dim::Row;
+  const Dimensions buf{dim, 21};
+  const auto make_index = [&](const auto &indices, const Dimensions &iter_dims,
+                              const Strides &strides) {
+    return MultiIndex<1>(ElementArrayViewParams{
+        0, iter_dims, strides,
+        BucketParams{dim, buf, Strides{buf}, indices.data()}});
+  };
+  const std::vector<std::pair<scipp::index, scipp::index>> indices{
+      {0, 1}, {1, 3}, {3, 6}, {6, 10}, {10, 15}, {15, 21}};
+  EXPECT_EQ(
+      make_index(indices, xy, make_strides(xy, xy)).cumulative_bin_sizes(),
+      (std::vector<scipp::index>{0, 1, 3, 6, 10, 15, 21}));
+  // Bins in order of iteration, not memory order.
+  EXPECT_EQ(
+      make_index(indices, yx, make_strides(yx, xy)).cumulative_bin_sizes(),
+      (std::vector<scipp::index>{0, 1, 5, 7, 12, 15, 21}));
+  EXPECT_EQ(make_index(indices, x, make_strides(x, xy)).cumulative_bin_sizes(),
+            (std::vector<scipp::index>{0, 1, 5}));
+  EXPECT_EQ(
+      make_index(indices, Dimensions{}, Strides{}).cumulative_bin_sizes(),
+      (std::vector<scipp::index>{0, 1}));
+  const Dimensions empty{Dim::X, 0};
+  EXPECT_EQ(make_index(std::vector<std::pair<scipp::index, scipp::index>>{},
+                       empty, make_strides(empty, empty))
+                .cumulative_bin_sizes(),
+            (std::vector<scipp::index>{0}));
+}
+
+TEST_F(MultiIndexTest, set_index_within_bin) {
+  const Dim dim = Dim::Row;
+  const Dimensions buf{dim, 7};
+  const std::vector<std::pair<scipp::index, scipp::index>> indices{{0, 3},
+                                                                   {4, 7}};
+  const BucketParams params{dim, buf, Strides{buf}, indices.data()};
+  const ElementArrayViewParams binned{0, x, make_strides(x, x), params};
+  const ElementArrayViewParams dense{0, x, make_strides(x, x), BucketParams{}};
+
+  MultiIndex<2> index(binned, dense);
+  ASSERT_TRUE(index.can_split_bins());
+  auto end = index;
+  end.set_index(1, 2);
+  EXPECT_EQ(end.get(), (std::array<scipp::index, 2>{6, 1}));
+  index.set_index(0, 1);
+  std::vector<std::array<scipp::index, 2>> visited;
+  for (; index != end; index.increment())
+    visited.push_back(index.get());
+  EXPECT_EQ(visited, (std::vector<std::array<scipp::index, 2>>{
+                         {1, 0}, {2, 0}, {4, 1}, {5, 1}}));
+
+  // Dense output cannot be split since it is shared by all events in a bin.
+  EXPECT_FALSE(MultiIndex<2>(dense, binned).can_split_bins());
+  // Non-binned.
+  EXPECT_FALSE(MultiIndex<1>(dense).can_split_bins());
+}
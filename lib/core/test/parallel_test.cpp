@@ -0,0 +1,138 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+#include "scipp/core/parallel.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+class ParallelTest : public ::testing::Test {
+protected:
+  ~ParallelTest() override { parallel::reset_max_threads(); }
+};
+
+TEST_F(ParallelTest, set_max_threads) {
+  parallel::set_max_threads(1);
+  EXPECT_EQ(parallel::max_threads(), 1);
+  parallel::reset_max_threads();
+  EXPECT_GE(parallel::max_threads(), 1);
+}
+
+TEST_F(ParallelTest, max_threads_is_default) {
+  EXPECT_TRUE(parallel::max_threads_is_default());
+  parallel::set_max_threads(1);
+  if (parallel::max_threads_is_default())
+    GTEST_SKIP() << "Built without multi-threading support.";
+  parallel::reset_max_threads();
+  EXPECT_TRUE(parallel::max_threads_is_default());
+}
+
+TEST_F(ParallelTest, set_max_threads_invalid) {
+  EXPECT_THROW(parallel::set_max_threads(0), std::invalid_argument);
+  EXPECT_THROW(parallel::set_max_threads(-1), std::invalid_argument);
+}
+
+TEST_F(ParallelTest, parallel_for_visits_all) {
+  for (const scipp::index threads : {1, 2}) {
+    parallel::set_max_threads(threads);
+    std::vector<scipp::index> v(10000);
+    parallel::parallel_for(parallel::blocked_range(0, scipp::size(v)),
+                           [&](const auto &range) {
+                             for (auto i = range.begin(); i < range.end(); ++i)
+                               v[i] += i;
+                           });
+    std::vector<scipp::index> expected(v.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(v, expected);
+  }
+}
+
+TEST_F(ParallelTest, nested) {
+  std::atomic<scipp::index> count{0};
+  const auto inner = [&](const auto &range) {
+    count += range.end() - range.begin();
+  };
+  parallel::parallel_for(parallel::blocked_range(0, 100, 1),
+                         [&](const auto &range) {
+                           for (auto i = range.begin(); i < range.end(); ++i)
+                             parallel::parallel_for(
+                                 parallel::blocked_range(0, 100, 1), inner);
+                         });
+  EXPECT_EQ(count, 100 * 100);
+}
+
+TEST_F(ParallelTest, set_max_threads_inside_parallel_for_throws) {
+  parallel::set_max_threads(2);
+  if (parallel::max_threads() == 1)
+    GTEST_SKIP() << "Built without multi-threading support.";
+  parallel::parallel_for(parallel::blocked_range(0, 2, 1), [&](const auto &) {
+    EXPECT_THROW(parallel::set_max_threads(1), std::runtime_error);
+  });
+}
+
+TEST(GrainSizeTest, small_input_is_not_split) {
+  const parallel::ElementCost cost{8};
+  EXPECT_GE(parallel::grain_size(1000, cost, 64), 1000);
+  EXPECT_GE(parallel::grain_size(1, cost, 64), 1);
+  EXPECT_GE(parallel::grain_size(0, cost, 64), 1);
+}
+
+TEST(GrainSizeTest, targets_multiple_tasks_per_thread) {
+  const parallel::ElementCost cost{8};
+  const scipp::index size = 10'000'000;
+  for (const scipp::index threads : {1, 4, 128}) {
+    const auto grain = parallel::grain_size(size, cost, threads);
+    EXPECT_LE(grain, size / (threads * parallel::tasks_per_thread) + 1);
+  }
+}
+
+TEST(GrainSizeTest, tasks_fit_into_cache) {
+  const parallel::ElementCost cost{8};
+  EXPECT_EQ(parallel::grain_size(1'000'000'000, cost, 4),
+            parallel::max_task_bytes / 8);
+  EXPECT_EQ(parallel::grain_size(1'000'000'000, {64}, 4),
+            parallel::max_task_bytes / 64);
+}
+
+TEST(GrainSizeTest, expensive_elements_give_smaller_grain) {
+  const scipp::index size = 100'000;
+  EXPECT_GT(parallel::grain_size(size, {8, 1.0}, 128),
+            parallel::grain_size(size, {8, 100.0}, 128));
+  EXPECT_GT(parallel::grain_size(size, {8}, 128),
+            parallel::grain_size(size, {800}, 128));
+}
+
+TEST(WeightedPartitionTest, balances_weight) {
+  // Item sizes 1, 1, 10, 1, 1.
+  const std::vector<scipp::index> cumulative{0, 1, 2, 12, 13, 14};
+  using Bounds = std::vector<std::pair<scipp::index, scipp::index>>;
+  EXPECT_EQ(parallel::weighted_partition(cumulative, 1, false),
+            (Bounds{{0, 0}, {5, 0}}));
+  EXPECT_EQ(parallel::weighted_partition(cumulative, 2, false),
+            (Bounds{{0, 0}, {3, 0}, {5, 0}}));
+  EXPECT_EQ(parallel::weighted_partition(cumulative, 2, true),
+            (Bounds{{0, 0}, {2, 5}, {5, 0}}));
+  EXPECT_EQ(parallel::weighted_partition(cumulative, 4, true),
+            (Bounds{{0, 0}, {2, 1}, {2, 5}, {2, 8}, {5, 0}}));
+}
+
+TEST(WeightedPartitionTest, merges_tasks_within_items) {
+  const std::vector<scipp::index> cumulative{0, 100, 101};
+  using Bounds = std::vector<std::pair<scipp::index, scipp::index>>;
+  EXPECT_EQ(parallel::weighted_partition(cumulative, 4, false),
+            (Bounds{{0, 0}, {1, 0}, {2, 0}}));
+}
+
+TEST(WeightedPartitionTest, empty) {
+  using Bounds = std::vector<std::pair<scipp::index, scipp::index>>;
+  EXPECT_EQ(parallel::weighted_partition(std::vector<scipp::index>{0}, 4, true),
+            (Bounds{{0, 0}, {0, 0}}));
+  EXPECT_EQ(
+      parallel::weighted_partition(std::vector<scipp::index>{0, 0, 0}, 4, true),
+      (Bounds{{0, 0}, {2, 0}}));
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "scipp/core/profiler.h"
+
+using namespace scipp;
+using namespace scipp::core;
+
+class ProfilerTest : public ::testing::Test {
+protected:
+  ProfilerTest() {
+    profiler::reset();
+    profiler::set_enabled(true);
+  }
+  ~ProfilerTest() override {
+    profiler::set_enabled(false);
+    profiler::reset();
+  }
+};
+
+TEST_F(ProfilerTest, disabled_records_nothing) {
+  profiler::set_enabled(false);
+  {
+    profiler::Scope scope("op");
+    EXPECT_EQ(profiler::current(), nullptr);
+  }
+  EXPECT_TRUE(profiler::stats().empty());
+}
+
+TEST_F(ProfilerTest, aggregates_calls_by_name) {
+  for (int i = 0; i < 3; ++i) {
+    profiler::Scope scope("op");
+    EXPECT_EQ(profiler::current(), &scope);
+    profiler::TaskStats task;
+    task.add_chunk(profiler::Loop::Vectorized, 10);
+    task.add_chunk(profiler::Loop::Generic, 5);
+    task.bytes_read = 15 * 16;
+    task.bytes_written = 15 * 8;
+    scope.add_task(task);
+  }
+  EXPECT_EQ(profiler::current(), nullptr);
+  const auto stats = profiler::stats();
+  ASSERT_EQ(stats.size(), 1);
+  EXPECT_EQ(stats[0].name, "op");
+  EXPECT_EQ(stats[0].calls, 3);
+  EXPECT_EQ(stats[0].elements, 45);
+  EXPECT_EQ(stats[0].bytes_read, 3 * 15 * 16);
+  EXPECT_EQ(stats[0].bytes_written, 3 * 15 * 8);
+  EXPECT_EQ(stats[0].max_threads, 1);
+  EXPECT_EQ(stats[0].vectorized_chunks, 3);
+  EXPECT_EQ(stats[0].specialized_chunks, 0);
+  EXPECT_EQ(stats[0].generic_chunks, 3);
+  EXPECT_GE(stats[0].seconds, 0.0);
+}
+
+TEST_F(ProfilerTest, counts_distinct_threads) {
+  {
+    profiler::Scope scope("op");
+    profiler::TaskStats task;
+    task.add_chunk(profiler::Loop::Generic, 1);
+    scope.add_task(task);
+    scope.add_task(task);
+    std::thread([&]() { scope.add_task(task); }).join();
+  }
+  const auto stats = profiler::stats();
+  ASSERT_EQ(stats.size(), 1);
+  EXPECT_EQ(stats[0].elements, 3);
+  EXPECT_EQ(stats[0].max_threads, 2);
+}
+
+TEST_F(ProfilerTest, nested_scopes) {
+  {
+    profiler::Scope outer("outer");
+    {
+      profiler::Scope inner("inner");
+      EXPECT_EQ(profiler::current(), &inner);
+    }
+    EXPECT_EQ(profiler::current(), &outer);
+  }
+  EXPECT_EQ(profiler::stats().size(), 2);
+}
+
+TEST_F(ProfilerTest, attach) {
+  profiler::Scope scope("op");
+  {
+    const profiler::Attach attach(nullptr);
+    EXPECT_EQ(profiler::current(), nullptr);
+  }
+  EXPECT_EQ(profiler::current(), &scope);
+}
+
+TEST_F(ProfilerTest, reset) {
+  { profiler::Scope scope("op"); }
+  profiler::reset();
+  EXPECT_TRUE(profiler::stats().empty());
+}
+
+TEST_F(ProfilerTest, summary) {
+  { profiler::Scope scope("some_op"); }
+  EXPECT_NE(profiler::summary().find("some_op"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, chrome_trace) {
+  { profiler::Scope scope("a\"b"); }
+  const auto trace = profiler::chrome_trace();
+  EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0);
+  EXPECT_NE(trace.find("\"name\":\"a\\\"b\""), std::string::npos);
+  EXPECT_NE(trace.find("\"ph\":\"X\""), std::string::npos);
+}
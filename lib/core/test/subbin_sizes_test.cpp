@@ -69,6 +69,22 @@ TEST_F(SubbinSizesTest, trim_to) {
   EXPECT_EQ(x, SubbinSizes(2, {0, 2, 3}));
 }
 
+TEST_F(SubbinSizesTest, exclusive_scan) {
+  SubbinSizes sum(2, {1, 2, 3});
+  SubbinSizes x(3, {4, 5, 6});
+  sum.exclusive_scan(x);
+  EXPECT_EQ(x, SubbinSizes(3, {2, 3, 0}));
+  EXPECT_EQ(sum, SubbinSizes(3, {6, 8, 6}));
+  SubbinSizes y(1, {1, 1, 1, 1, 1});
+  sum.exclusive_scan(y);
+  EXPECT_EQ(y, SubbinSizes(1, {0, 0, 6, 8, 6}));
+  EXPECT_EQ(sum, SubbinSizes(1, {1, 1, 7, 9, 7}));
+  SubbinSizes z(5, {1});
+  sum.exclusive_scan(z);
+  EXPECT_EQ(z, SubbinSizes(5, {7}));
+  EXPECT_EQ(sum, SubbinSizes(5, {8}));
+}
+
 TEST_F(SubbinSizesTest, add_intersection) {
   SubbinSizes x(2, {1, 2, 3});
   // no overlap
@@ -2,13 +2,19 @@
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <array>
+#include <functional>
 #include <numeric>
 #include <set>
+#include <span>
 
 #include "scipp/common/ranges.h"
 
 #include "scipp/core/element/bin.h"
 #include "scipp/core/element/cumulative.h"
+#include "scipp/core/histogram.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/profiler.h"
 
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bin_detail.h"
@@ -49,8 +55,16 @@ auto make_range(const scipp::index begin, const scipp::index end,
                 dim, CumSumMode::Exclusive);
 }
 
+} // namespace
+
+/// Update flat output bin `indices` by binning `key` with the given `edges`.
+///
+/// Indices are multiplied by the number of bins before adding the bin of each
+/// event, so applying this for several dims yields row-major flat indices.
+/// Events outside the edges get index -1.
 void update_indices_by_binning(Variable &indices, const Variable &key,
-                               const Variable &edges, const bool linspace) {
+                               const Variable &edges,
+                               const variable::EdgeProperties &properties) {
   const auto dim = edges.dims().inner();
   if (!indices.dims().includes(key.dims()))
     throw except::BinEdgeError(
@@ -60,7 +74,7 @@ void update_indices_by_binning(Variable &indices, const Variable &key,
         "bin-edge coordinate to a non-edge coordinate.");
   const auto &edge_view =
       is_bins(edges) ? as_subspan_view(edges) : subspan_view(edges, dim);
-  if (linspace) {
+  if (properties.linspace) {
     variable::transform_in_place(
         indices, key, edge_view,
         core::element::update_indices_by_binning_linspace,
@@ -73,6 +87,68 @@ void update_indices_by_binning(Variable &indices, const Variable &key,
   }
 }
 
+namespace {
+
+bool is_contiguous_1d(const Variable &var) {
+  return var.dims().ndim() == 1 && var.strides()[0] == 1;
+}
+
+/// Fused variant of `update_indices_by_binning` for binning along multiple
+/// dims with linspace edges, followed by `bin_sizes`.
+///
+/// Computes the flat target bin index of every event in a single pass over the
+/// event coords `keys`, and counts the events of every input bin given by
+/// `ranges` in the same pass.
+template <class Index, class T>
+Variable bin_linspace(Variable &indices, const Variable &ranges,
+                      const std::vector<Variable> &keys,
+                      const std::vector<Variable> &edges,
+                      const scipp::index nbin) {
+  struct Axis {
+    std::span<const T> key;
+    T offset;
+    scipp::index nbin;
+    double scale;
+  };
+  std::vector<Axis> axes;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    const auto [offset, n, scale] =
+        core::linear_edge_params(edges[i].values<T>().as_span());
+    axes.push_back({keys[i].values<T>().as_span(), offset, n, scale});
+  }
+  const auto out = indices.values<Index>().as_span();
+  auto sizes = makeVariable<core::SubbinSizes>(ranges.dims());
+  const auto sizes_out = sizes.values<core::SubbinSizes>().as_span();
+  const auto bin_ranges = ranges.values<scipp::index_pair>().as_span();
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, scipp::size(bin_ranges)),
+      [&](const auto &range) {
+        for (auto b = range.begin(); b != range.end(); ++b) {
+          core::SubbinSizes::container_type counts(nbin);
+          const auto [begin, end] = bin_ranges[b];
+          for (auto i = begin; i < end; ++i) {
+            Index index = 0;
+            // Same arithmetic as update_indices_by_binning_linspace, to
+            // obtain identical results at the bin boundaries.
+            for (const auto &axis : axes) {
+              const double bin = (axis.key[i] - axis.offset) * axis.scale;
+              index *= axis.nbin;
+              if (bin < 0.0 || bin >= axis.nbin) {
+                index = -1;
+                break;
+              }
+              index = static_cast<Index>(index + bin);
+            }
+            out[i] = index;
+            if (index >= 0)
+              ++counts[index];
+          }
+          sizes_out[b] = core::SubbinSizes{0, std::move(counts)};
+        }
+      });
+  return sizes;
+}
+
 template <class Index>
 Variable groups_to_map(const Variable &var, const Dim dim) {
   return variable::transform(subspan_view(var, dim),
@@ -107,6 +183,93 @@ Variable bin_sizes(const Variable &sub_bin, const Variable &offset,
       "scipp.bin.bin_sizes"); // transform bins, not bin element
 }
 
+/// Copy elements of one column of the event buffer from input positions `src`
+/// to output positions `dst`.
+using ScatterBlock = std::function<void(std::span<const scipp::index> src,
+                                        std::span<const scipp::index> dst)>;
+
+template <class T>
+ScatterBlock make_scatter_block(const Variable &in, Variable &out) {
+  const auto in_values = in.values<T>().as_span();
+  const auto out_values = out.values<T>().as_span();
+  if constexpr (core::canHaveVariances<T>()) {
+    if (in.hasVariances()) {
+      const auto in_variances = in.variances<T>().as_span();
+      const auto out_variances = out.variances<T>().as_span();
+      return [=](const auto src, const auto dst) {
+        for (size_t k = 0; k < src.size(); ++k) {
+          out_values[dst[k]] = in_values[src[k]];
+          out_variances[dst[k]] = in_variances[src[k]];
+        }
+      };
+    }
+  }
+  return [=](const auto src, const auto dst) {
+    for (size_t k = 0; k < src.size(); ++k)
+      out_values[dst[k]] = in_values[src[k]];
+  };
+}
+
+/// Return a scatter for a column with element type in Ts, or an empty function
+/// if the column is not supported.
+template <class... Ts>
+ScatterBlock make_scatter(const Variable &in, Variable &out) {
+  ScatterBlock scatter;
+  if (is_contiguous_1d(in) && is_contiguous_1d(out))
+    static_cast<void>(((in.dtype() == dtype<Ts> &&
+                        (scatter = make_scatter_block<Ts>(in, out), true)) ||
+                       ...));
+  return scatter;
+}
+
+/// Copy all columns of the event buffer to their output bins in a single pass.
+///
+/// This is equivalent to applying `core::element::bin` to every column but
+/// reads `offsets` and the target bin indices only once. Events are processed
+/// in blocks: The output positions for a block are computed once and then used
+/// for all columns, while they are still in cache.
+template <class Index>
+void scatter_columns(const std::vector<ScatterBlock> &columns,
+                     const Variable &offsets, const Variable &out_ranges,
+                     const Variable &in_ranges, const Variable &target_ranges,
+                     const Variable &target_bins) {
+  constexpr scipp::index block_size = 512;
+  const auto offsets_ = offsets.values<core::SubbinSizes>().as_span();
+  const auto out_ranges_ = out_ranges.values<scipp::index_pair>().as_span();
+  const auto in_ranges_ = in_ranges.values<scipp::index_pair>().as_span();
+  const auto target_ranges_ =
+      target_ranges.values<scipp::index_pair>().as_span();
+  const auto target_bins_ = target_bins.values<Index>().as_span();
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, scipp::size(offsets_), 1),
+      [&](const auto &range) {
+        std::array<scipp::index, block_size> src;
+        std::array<scipp::index, block_size> dst;
+        for (auto b = range.begin(); b != range.end(); ++b) {
+          auto bins(offsets_[b].sizes());
+          const auto in_begin = in_ranges_[b].first;
+          const auto out_begin = out_ranges_[b].first;
+          const auto [begin, end] = target_ranges_[b];
+          scipp::index n = 0;
+          const auto flush = [&]() {
+            for (const auto &column : columns)
+              column(std::span(src.data(), n), std::span(dst.data(), n));
+            n = 0;
+          };
+          for (auto i = begin; i < end; ++i) {
+            const auto i_bin = target_bins_[i];
+            if (i_bin < 0)
+              continue;
+            src[n] = in_begin + (i - begin);
+            dst[n] = out_begin + bins[i_bin]++;
+            if (++n == block_size)
+              flush();
+          }
+          flush();
+        }
+      });
+}
+
 template <class T, class Builder>
 auto bin(const Variable &data, const Variable &indices,
          const Builder &builder) {
@@ -114,7 +277,10 @@ auto bin(const Variable &data, const Variable &indices,
   // Setup offsets within output bins, for every input bin. If rebinning occurs
   // along a dimension each output bin sees contributions from all input bins
   // along that dim.
-  auto output_bin_sizes = bin_sizes(indices, builder.offsets(), builder.nbin());
+  auto output_bin_sizes =
+      builder.bin_sizes().is_valid()
+          ? builder.bin_sizes()
+          : bin_sizes(indices, builder.offsets(), builder.nbin());
   auto offsets = copy(output_bin_sizes);
   fill_zeros(offsets);
   // Not using cumsum along *all* dims, since some outer dims may be left
@@ -139,6 +305,20 @@ auto bin(const Variable &data, const Variable &indices,
       zip(end - filtered_input_bin_size, end);
 
   // Perform actual binning step for data, all coords, all masks, ...
+  // Columns are scattered in a single fused pass where possible. The bin
+  // parameters are flattened, which requires identical dims.
+  const auto in_ranges = copy(std::get<0>(data.constituents<T>()));
+  const auto &[target_indices, target_dim, target_bins] =
+      indices.constituents<Variable>();
+  static_cast<void>(target_dim);
+  const auto target_ranges = copy(target_indices);
+  const auto out_ranges = copy(filtered_input_bin_ranges);
+  const bool fused = offsets.dims() == data.dims() &&
+                    out_ranges.dims() == data.dims() &&
+                    in_ranges.dims() == data.dims() &&
+                    target_ranges.dims() == data.dims() &&
+                    is_contiguous_1d(target_bins);
+  std::vector<ScatterBlock> columns;
   auto out_buffer =
       dataset::transform(bins_view<T>(data), [&](const auto &var) {
         if (!is_bins(var))
@@ -147,12 +327,30 @@ auto bin(const Variable &data, const Variable &indices,
             var.template constituents<Variable>();
         static_cast<void>(input_indices);
         auto out = resize_default_init(in_buffer, buffer_dim, total_size);
+        if (fused) {
+          if (auto scatter =
+                  make_scatter<double, float, int64_t, int32_t, bool,
+                               Eigen::Vector3d, std::string, core::time_point>(
+                      in_buffer, out)) {
+            columns.emplace_back(std::move(scatter));
+            return out;
+          }
+        }
         transform_in_place(
             subspan_view(out, buffer_dim, filtered_input_bin_ranges), offsets,
             as_subspan_view(var), as_subspan_view(indices), core::element::bin,
             "bin");
         return out;
       });
+  if (!columns.empty()) {
+    const core::profiler::Scope scope("scipp.bin.scatter");
+    if (target_bins.dtype() == dtype<int64_t>)
+      scatter_columns<int64_t>(columns, offsets, out_ranges, in_ranges,
+                               target_ranges, target_bins);
+    else
+      scatter_columns<int32_t>(columns, offsets, out_ranges, in_ranges,
+                               target_ranges, target_bins);
+  }
 
   // Up until here the output was viewed with same bin index ranges as input.
   // Now switch to desired final bin indices.
@@ -235,6 +433,10 @@ public:
   [[nodiscard]] const Dimensions &dims() const noexcept { return m_dims; }
   [[nodiscard]] const Variable &offsets() const noexcept { return m_offsets; }
   [[nodiscard]] const Variable &nbin() const noexcept { return m_nbin; }
+  /// Sub-bin sizes of every input bin, if computed by `build_linspace`.
+  [[nodiscard]] const Variable &bin_sizes() const noexcept {
+    return m_bin_sizes;
+  }
 
   /// `bin_coords` may optionally be used to provide bin-based coords, e.g., for
   /// data that has prior grouping but did not retain the original group coord
@@ -250,7 +452,7 @@ public:
       if (action == AxisAction::Group)
         update_indices_by_grouping(indices, get_coord(dim), key);
       else if (action == AxisAction::Bin) {
-        const auto linspace = all(islinspace(key, dim)).template value<bool>();
+        const auto properties = edge_properties(key, dim);
         // When binning along an existing dim with a coord (may be edges or
         // not), not all input bins can map to all output bins. The array of
         // subbin sizes that is normally created thus contains mainly zero
@@ -295,9 +497,9 @@ public:
           // there is no overlap between given input and output bin.
           const auto masked_key = make_bins_no_validate(indices_, dim, key);
           update_indices_by_binning(indices, get_coord(dim), masked_key,
-                                    linspace);
+                                    properties);
         } else {
-          update_indices_by_binning(indices, get_coord(dim), key, linspace);
+          update_indices_by_binning(indices, get_coord(dim), key, properties);
         }
       } else if (action == AxisAction::Existing)
         update_indices_from_existing(indices, dim);
@@ -307,6 +509,57 @@ public:
     }
   }
 
+  /// Faster alternative to `build` for dense tables binned only along dims
+  /// with linspace edges, e.g., pixel position and time-of-flight.
+  ///
+  /// Instead of one pass over all events per dim, the flat target bin index is
+  /// computed in a single pass. The events of every input bin, given by
+  /// `ranges`, are counted in the same pass, so `bin` can skip counting them
+  /// again. Returns false without side effects if not applicable.
+  template <class CoordsT>
+  bool build_linspace(Variable &indices, const Variable &ranges,
+                      const CoordsT &coords) {
+    if (m_actions.empty() || !is_contiguous_1d(indices))
+      return false;
+    const auto first_dim = std::get<1>(m_actions.front());
+    const auto coord_dtype =
+        coords.count(first_dim) ? coords[first_dim].dtype() : dtype<void>;
+    if (coord_dtype != dtype<double> && coord_dtype != dtype<float>)
+      return false;
+    std::vector<Variable> keys;
+    std::vector<Variable> bin_edges;
+    for (const auto &[action, dim, key_edges] : m_actions) {
+      if (action != AxisAction::Bin || !coords.count(dim))
+        return false;
+      const auto &key = coords[dim];
+      if (key.dtype() != coord_dtype || key_edges.dtype() != coord_dtype ||
+          key.dims() != indices.dims() || !is_contiguous_1d(key) ||
+          !is_contiguous_1d(key_edges) || key.hasVariances() ||
+          key_edges.hasVariances() || key.unit() != key_edges.unit() ||
+          !alllinspace(key_edges, dim))
+        return false;
+      keys.emplace_back(key);
+      bin_edges.emplace_back(key_edges);
+    }
+    const auto nbin = dims().volume();
+    m_offsets = makeVariable<scipp::index>(Values{0});
+    m_nbin = nbin * units::one;
+    const bool wide = indices.dtype() == dtype<int64_t>;
+    if (coord_dtype == dtype<double>)
+      m_bin_sizes =
+          wide ? bin_linspace<int64_t, double>(indices, ranges, keys,
+                                               bin_edges, nbin)
+               : bin_linspace<int32_t, double>(indices, ranges, keys,
+                                               bin_edges, nbin);
+    else
+      m_bin_sizes =
+          wide ? bin_linspace<int64_t, float>(indices, ranges, keys, bin_edges,
+                                              nbin)
+               : bin_linspace<int32_t, float>(indices, ranges, keys, bin_edges,
+                                              nbin);
+    return true;
+  }
+
   [[nodiscard]] auto edges() const noexcept {
     std::vector<Variable> vars;
     for (const auto &[action, dim, key] : m_actions) {
@@ -357,6 +610,7 @@ private:
   Dimensions m_dims;
   Variable m_offsets;
   Variable m_nbin;
+  Variable m_bin_sizes;
   std::vector<std::tuple<AxisAction, Dim, Variable>> m_actions;
   std::vector<Variable> m_joined;
 };
@@ -560,7 +814,8 @@ DataArray bin(const DataArray &array, const std::vector<Variable> &edges,
             ? makeVariable<int64_t>(data.dims())
             : makeVariable<int32_t>(data.dims());
     auto builder = axis_actions(data, coords, edges, groups, erase);
-    builder.build(target_bins_buffer, coords);
+    if (!builder.build_linspace(target_bins_buffer, indices, coords))
+      builder.build(target_bins_buffer, coords);
     const auto target_bins =
         make_bins_no_validate(indices, dim, target_bins_buffer);
     return add_metadata(bin<DataArray>(drop_grouped_event_coords(tmp, groups),
@@ -3,6 +3,9 @@
 /// @file
 /// @author Simon Heybrock
 #include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
 
 #include "scipp/common/overloaded.h"
 #include "scipp/core/bucket.h"
@@ -10,6 +13,7 @@
 #include "scipp/core/element/histogram.h"
 #include "scipp/core/except.h"
 #include "scipp/core/histogram.h"
+#include "scipp/core/parallel.h"
 
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
@@ -33,6 +37,7 @@
 
 #include "../variable/operations_common.h"
 #include "bin_common.h"
+#include "bins_util.h"
 #include "dataset_operations_common.h"
 
 namespace scipp::dataset {
@@ -187,7 +192,24 @@ bool is_bins(const Dataset &dataset) {
 namespace scipp::dataset::buckets {
 namespace {
 
-template <class T> auto combine(const Variable &var0, const Variable &var1) {
+/// Return begin indices and total buffer size for bins laid out contiguously
+/// with given capacity.
+auto layout(const Variable &capacity) {
+  const auto end = cumsum(capacity);
+  const auto total_size =
+      end.dims().volume() > 0
+          ? end.template values<scipp::index>().as_span().back()
+          : 0;
+  return std::pair{end - capacity, total_size};
+}
+
+/// Concatenate the bins of `var0` and `var1` into a new buffer.
+///
+/// If `grow` is true each bin is allocated with twice the required capacity,
+/// such that subsequent appends can be performed in-place.
+template <class T>
+auto combine(const Variable &var0, const Variable &var1,
+             const bool grow = false) {
   const auto &[indices0, dim0, buffer0] = var0.constituents<T>();
   const auto &[indices1, dim1, buffer1] = var1.constituents<T>();
   static_cast<void>(buffer1);
@@ -198,18 +220,111 @@ template <class T> auto combine(const Variable &var0, const Variable &var1) {
   const auto sizes0 = end0 - begin0;
   const auto sizes1 = end1 - begin1;
   const auto sizes = sizes0 + sizes1;
-  const auto end = cumsum(sizes);
-  const auto begin = end - sizes;
-  const auto total_size =
-      end.dims().volume() > 0
-          ? end.template values<scipp::index>().as_span().back()
-          : 0;
+  const auto [begin, total_size] = layout(grow ? sizes + sizes : sizes);
+  const auto end = begin + sizes;
   auto buffer = resize_default_init(buffer0, dim, total_size);
   copy_slices(buffer0, buffer, dim, indices0, zip(begin, end - sizes1));
   copy_slices(buffer1, buffer, dim, indices1, zip(begin + sizes0, end));
   return make_bins_no_validate(zip(begin, end), dim, std::move(buffer));
 }
 
+/// Return true if the buffer of `var` holds space beyond the events in its
+/// bins, i.e., if capacity was reserved.
+template <class T> bool has_spare_capacity(const Variable &var) {
+  if (var.is_slice())
+    return false;
+  const auto &[indices, dim, buffer] = var.constituents<T>();
+  const auto [begin, end] = unzip(indices);
+  return buffer.dims()[dim] > sum(end - begin).template value<scipp::index>();
+}
+
+/// Append the events of `var1` to the bins of `var0` without reallocation.
+///
+/// This is possible only if the bins of `var0` are laid out in order and
+/// every bin is followed by enough unused space in the buffer. Returns false,
+/// leaving `var0` unchanged, otherwise.
+template <class T> bool append_in_place(Variable &var0, const Variable &var1) {
+  if (var0.dims() != var1.dims())
+    return false;
+  auto &&[indices0, dim, buffer0] = var0.constituents<T>();
+  const auto &[indices1, dim1, buffer1] = var1.constituents<T>();
+  static_cast<void>(dim1);
+  const auto [begin1, end1] = unzip(indices1);
+  const auto sizes1 = end1 - begin1;
+  const auto ranges =
+      std::as_const(indices0).template values<scipp::index_pair>();
+  const auto sizes = sizes1.template values<scipp::index>();
+  const auto buffer_size = buffer0.dims()[dim];
+  auto size = sizes.begin();
+  for (auto it = ranges.begin(); it != ranges.end(); ++it, ++size) {
+    const auto next = std::next(it);
+    const auto limit = next == ranges.end() ? buffer_size : next->first;
+    if (it->second + *size > limit)
+      return false;
+  }
+  // `var1` may share indices with `var0`, copy events before updating them.
+  const auto end0 = unzip(indices0).second;
+  copy_slices(buffer1, buffer0, dim, indices1, zip(end0, end0 + sizes1));
+  size = sizes.begin();
+  for (auto &range : indices0.template values<scipp::index_pair>())
+    range.second += *size++;
+  return true;
+}
+
+/// Throw unless the bins of `var` can be modified in place.
+void expect_bins_writable(const Variable &var) {
+  if (var.is_slice())
+    throw except::SliceError("Cannot modify the bins of a slice in place.");
+  if (var.is_readonly())
+    throw except::VariableError("Read-only flag is set, cannot mutate bins.");
+}
+
+/// Replace the indices and buffer of `var` by those of `bins`.
+///
+/// The bin model of `var` is updated rather than replaced, such that shallow
+/// copies of `var` see the change, just like with `append_in_place`.
+template <class T> void assign_bins(Variable &var, Variable &&bins) {
+  if (bins.dims() != var.dims())
+    throw except::DimensionError("Cannot replace bins by bins of different "
+                                 "dimensions.");
+  auto [indices, dim, buffer] = bins.to_constituents<T>();
+  static_cast<void>(dim);
+  var.bin_buffer<T>() = std::move(buffer);
+  copy(indices, var.bin_indices());
+}
+
+template <class T> void append_impl(Variable &var0, const Variable &var1) {
+  if (!append_in_place<T>(var0, var1))
+    assign_bins<T>(var0,
+                   combine<T>(var0, var1, has_spare_capacity<T>(var0)));
+}
+
+constexpr auto max_index = overloaded{
+    core::element::arg_list<std::tuple<scipp::index, scipp::index>>,
+    [](const units::Unit &a, const units::Unit &b) {
+      core::expect::equals(a, b);
+      return a;
+    },
+    [](const auto a, const auto b) { return std::max(a, b); }};
+
+template <class T>
+auto reserved_bins(const Variable &var, const Variable &capacity) {
+  const auto &[indices, dim, buffer] = var.constituents<T>();
+  const auto [begin0, end0] = unzip(indices);
+  const auto sizes = end0 - begin0;
+  const auto [begin, total_size] =
+      layout(variable::transform(sizes, capacity, max_index, "reserve"));
+  const auto end = begin + sizes;
+  auto out = resize_default_init(buffer, dim, total_size);
+  copy_slices(buffer, out, dim, indices, zip(begin, end));
+  return make_bins_no_validate(zip(begin, end), dim, std::move(out));
+}
+
+template <class T>
+void reserve_impl(Variable &var, const Variable &capacity) {
+  assign_bins<T>(var, reserved_bins<T>(var, capacity));
+}
+
 template <class T>
 auto concatenate_impl(const Variable &var0, const Variable &var1) {
   return combine<T>(var0, var1);
@@ -249,13 +364,24 @@ DataArray concatenate(const DataArray &array, const Dim dim) {
   return groupby_concat_bins(array, {}, {}, {dim});
 }
 
+/// Append the events in the bins of `var1` to the bins of `var0`.
+///
+/// Events are written into the existing buffer if capacity for them has been
+/// reserved, see `reserve`. Otherwise the buffer is reallocated, doubling the
+/// capacity of every bin if `var0` had reserved capacity before, such that
+/// appending chunks one by one has amortized linear cost.
+/// In either case the bins of `var0` are modified in place, i.e., shallow
+/// copies of `var0` see the appended events.
+///
+/// Throws if `var0` is a slice or read-only.
 void append(Variable &var0, const Variable &var1) {
+  expect_bins_writable(var0);
   if (var0.dtype() == dtype<bucket<Variable>>)
-    var0.setDataHandle(combine<Variable>(var0, var1).data_handle());
+    append_impl<Variable>(var0, var1);
   else if (var0.dtype() == dtype<bucket<DataArray>>)
-    var0.setDataHandle(combine<DataArray>(var0, var1).data_handle());
+    append_impl<DataArray>(var0, var1);
   else
-    var0.setDataHandle(combine<Dataset>(var0, var1).data_handle());
+    append_impl<Dataset>(var0, var1);
 }
 
 void append(Variable &&var0, const Variable &var1) { append(var0, var1); }
@@ -268,6 +394,59 @@ void append(DataArray &a, const DataArray &b) {
   a.setData(data);
 }
 
+/// Reserve space for at least `capacity` events in every bin of `var`.
+///
+/// Bins are copied into a new buffer with unused space after the end of every
+/// bin, so subsequent calls to `append` can add events without moving existing
+/// ones. A copy of `var` drops the reserved space again. Like `append`, this
+/// modifies the bins of `var` in place.
+void reserve(Variable &var, const Variable &capacity) {
+  expect_bins_writable(var);
+  scipp::expect::includes(var.dims(), capacity.dims());
+  if (var.dtype() == dtype<bucket<Variable>>)
+    reserve_impl<Variable>(var, capacity);
+  else if (var.dtype() == dtype<bucket<DataArray>>)
+    reserve_impl<DataArray>(var, capacity);
+  else
+    reserve_impl<Dataset>(var, capacity);
+}
+
+void reserve(DataArray &array, const Variable &capacity) {
+  auto data = array.data();
+  reserve(data, capacity);
+  array.setData(data);
+}
+
+namespace {
+/// Return the number of chunks each bin is split into for histogramming.
+///
+/// Histogramming is threaded over bins, so if there are fewer bins than threads
+/// large bins are split into chunks that are histogrammed in parallel.
+scipp::index histogram_chunks(const Variable &indices,
+                              const scipp::index nbin) {
+  const auto threads = core::parallel::max_threads();
+  if (threads == 1 || indices.dims().volume() >= threads)
+    return 1;
+  scipp::index max_size = 0;
+  for (const auto &[begin, end] : indices.values<scipp::index_pair>())
+    max_size = std::max(max_size, end - begin);
+  return std::clamp(max_size / histogram_chunk_size(nbin), scipp::index{1},
+                    threads);
+}
+
+/// Return chunk `k` out of `nchunk` of every bin in `indices`.
+Variable bin_chunk(const Variable &indices, const scipp::index k,
+                   const scipp::index nchunk) {
+  auto out = copy(indices);
+  for (auto &[begin, end] : out.values<scipp::index_pair>()) {
+    const auto size = end - begin;
+    end = begin + size * (k + 1) / nchunk;
+    begin += size * k / nchunk;
+  }
+  return out;
+}
+} // namespace
+
 Variable histogram(const Variable &data, const Variable &binEdges) {
   using namespace scipp::core;
   auto hist_dim = binEdges.dims().inner();
@@ -282,11 +461,28 @@ Variable histogram(const Variable &data, const Variable &binEdges) {
   if (indices.dims().contains(hist_dim))
     indices.rename(hist_dim, dummy);
   const auto masked = masked_data(buffer, dim);
-  auto hist = variable::transform_subspan(
-      buffer.dtype(), hist_dim, binEdges.dims()[hist_dim] - 1,
-      subspan_view(buffer.meta()[hist_dim], dim, indices),
-      subspan_view(masked, dim, indices), binEdges, element::histogram,
-      "histogram");
+  const auto histogram_bins = [&](const Variable &bin_indices) {
+    return histogram_subspans(
+        buffer.dtype(), subspan_view(buffer.meta()[hist_dim], dim, bin_indices),
+        subspan_view(masked, dim, bin_indices), binEdges);
+  };
+  Variable hist;
+  if (const auto nchunk =
+          histogram_chunks(indices, binEdges.dims()[hist_dim] - 1);
+      nchunk > 1) {
+    std::vector<Variable> partial(nchunk);
+    const auto histogram_chunk = [&](const auto &range) {
+      for (auto k = range.begin(); k < range.end(); ++k)
+        partial[k] = histogram_bins(bin_chunk(indices, k, nchunk));
+    };
+    parallel::parallel_for(parallel::blocked_range(0, nchunk, 1),
+                           histogram_chunk);
+    hist = std::move(partial.front());
+    for (scipp::index k = 1; k < nchunk; ++k)
+      hist += partial[k];
+  } else {
+    hist = histogram_bins(indices);
+  }
   if (hist.dims().contains(dummy))
     return sum(hist, dummy);
   else
@@ -299,11 +495,12 @@ Variable map(const DataArray &function, const Variable &x, Dim dim) {
   const auto &edges = function.meta()[dim];
   const auto data = masked_data(function, dim);
   const auto weights = subspan_view(data, dim);
-  if (all(islinspace(edges, dim)).value<bool>()) {
+  const auto properties = edge_properties(edges, dim);
+  if (properties.linspace) {
     return variable::transform(x, subspan_view(edges, dim), weights,
                                core::element::event::map_linspace, "map");
   } else {
-    if (!allsorted(edges, dim))
+    if (!properties.ascending)
       throw except::BinEdgeError("Bin edges of histogram must be sorted.");
     return variable::transform(x, subspan_view(edges, dim), weights,
                                core::element::event::map_sorted_edges, "map");
@@ -322,12 +519,13 @@ void scale(DataArray &array, const DataArray &histogram, Dim dim) {
   const auto &edges = histogram.meta()[dim];
   const auto masked = masked_data(histogram, dim);
   const auto weights = subspan_view(masked, dim);
-  if (all(islinspace(edges, dim)).value<bool>()) {
+  const auto properties = edge_properties(edges, dim);
+  if (properties.linspace) {
     transform_in_place(data, coord, subspan_view(edges, dim), weights,
                        core::element::event::map_and_mul_linspace,
                        "bins.scale");
   } else {
-    if (!allsorted(edges, dim))
+    if (!properties.ascending)
       throw except::BinEdgeError("Bin edges of histogram must be sorted.");
     transform_in_place(data, coord, subspan_view(edges, dim), weights,
                        core::element::event::map_and_mul_sorted_edges,
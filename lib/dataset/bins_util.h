@@ -4,11 +4,31 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <algorithm>
+
+#include "scipp/core/element/histogram.h"
+#include "scipp/core/except.h"
 #include "scipp/dataset/bins.h"
+#include "scipp/variable/transform_subspan.h"
 #include "scipp/variable/util.h"
 
 namespace scipp::dataset {
 
+/// Minimum number of events per chunk when splitting events for histogramming
+/// in parallel.
+///
+/// Every chunk is accumulated into a separate partial histogram and the partial
+/// histograms are summed in a fixed order, so the result does not depend on
+/// scheduling. Smaller chunks would be dominated by zeroing and summing the
+/// partial histograms.
+constexpr scipp::index min_histogram_chunk = 65536;
+
+/// Return the minimum number of events per chunk for a histogram with `nbin`
+/// bins, see `min_histogram_chunk`.
+constexpr scipp::index histogram_chunk_size(const scipp::index nbin) {
+  return std::max(min_histogram_chunk, 4 * nbin);
+}
+
 template <class Masks>
 Variable hide_masked(const Variable &data, const Masks &masks,
                      const std::span<const Dim> dims) {
@@ -24,4 +44,33 @@ Variable hide_masked(const Variable &data, const Masks &masks,
   return make_bins_no_validate(indices, buffer_dim, buffer);
 }
 
+void update_indices_by_binning(Variable &indices, const Variable &key,
+                               const Variable &edges,
+                               const variable::EdgeProperties &properties);
+
+/// Return histogram of subspans of `coord` and `weights` with given bin edges.
+///
+/// Edges are checked once for all subspans, with the result cached by
+/// `edge_properties`, instead of by the kernel for every subspan.
+inline Variable histogram_subspans(const DType type, const Variable &coord,
+                                   const Variable &weights,
+                                   const Variable &edges) {
+  const auto dim = edges.dims().inner();
+  const auto nbin = edges.dims()[dim] - 1;
+  const auto properties = edge_properties(edges, dim);
+  if (properties.linspace)
+    return variable::transform_subspan(type, dim, nbin, coord, weights, edges,
+                                       core::element::histogram_linspace,
+                                       "histogram");
+  if (properties.logspace)
+    return variable::transform_subspan(type, dim, nbin, coord, weights, edges,
+                                       core::element::histogram_logspace,
+                                       "histogram");
+  if (!properties.ascending)
+    throw except::BinEdgeError("Bin edges of histogram must be sorted.");
+  return variable::transform_subspan(type, dim, nbin, coord, weights, edges,
+                                     core::element::histogram_sorted_edges,
+                                     "histogram");
+}
+
 } // namespace scipp::dataset
@@ -3,8 +3,12 @@
 /// @file
 /// @author Simon Heybrock
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <vector>
 
 #include "scipp/core/element/histogram.h"
+#include "scipp/core/parallel.h"
 #include "scipp/dataset/bins.h"
 #include "scipp/dataset/dataset.h"
 #include "scipp/dataset/except.h"
@@ -13,6 +17,7 @@
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/shape.h"
 #include "scipp/variable/transform_subspan.h"
+#include "scipp/variable/util.h"
 
 #include "bins_util.h"
 #include "dataset_operations_common.h"
@@ -60,17 +65,30 @@ DataArray histogram(const DataArray &events, const Variable &binEdges) {
         [dim](const DataArray &events_, const Dim event_dim_,
               const Variable &binEdges_) {
           const auto data = masked_data(events_, event_dim_);
+          if (events_.dims().ndim() == 1) {
+            // A single large table can be split into chunks that are
+            // histogrammed in parallel, which is handled by the binned path.
+            DataArray buffer(as_contiguous(data, event_dim_),
+                             {{dim, as_contiguous(events_.coords()[dim],
+                                                  event_dim_)}});
+            const auto size = buffer.dims()[event_dim_];
+            return buckets::histogram(
+                make_bins_no_validate(makeVariable<scipp::index_pair>(
+                                          Values{scipp::index_pair{0, size}}),
+                                      event_dim_, std::move(buffer)),
+                binEdges_);
+          }
           // Warning: Don't try to move the `as_contiguous` into `subspan_view`
           // without special care: It may return a new variable which will go
           // out of scope, leading to subtle bugs. Here on the other hand the
           // returned temporary is kept alive until the end of the
           // full-expression.
-          return transform_subspan(
-              events_.dtype(), dim, binEdges_.dims()[dim] - 1,
+          return histogram_subspans(
+              events_.dtype(),
               subspan_view(as_contiguous(events_.coords()[dim], event_dim_),
                            event_dim_),
               subspan_view(as_contiguous(data, event_dim_), event_dim_),
-              binEdges_, element::histogram, "histogram");
+              binEdges_);
         },
         event_dim, binEdges);
   } else {
@@ -82,6 +100,132 @@ DataArray histogram(const DataArray &events, const Variable &binEdges) {
   return result;
 }
 
+namespace {
+/// Return histogram with given `dims` of `weights` by flat bin `indices`.
+///
+/// Events are split into chunks that are accumulated in parallel, see
+/// `histogram_chunk_size`.
+template <class T, class Index>
+Variable histogram_flat(const Variable &indices, const Variable &weights,
+                        const Dimensions &dims) {
+  const auto index = indices.values<Index>().as_span();
+  const auto values = weights.values<T>().as_span();
+  const bool variances = weights.hasVariances();
+  const auto nevent = scipp::size(index);
+  const auto nbin = dims.volume();
+  const auto nchunk =
+      std::clamp(nevent / histogram_chunk_size(nbin), scipp::index{1},
+                 core::parallel::max_threads());
+  // Values and variances are interleaved and accumulated in double precision.
+  const scipp::index stride = variances ? 2 : 1;
+  std::vector<double> partial(nchunk * stride * nbin);
+  const auto accumulate = [&](const auto &range) {
+    for (auto k = range.begin(); k < range.end(); ++k) {
+      auto *out = partial.data() + k * stride * nbin;
+      const auto begin = nevent * k / nchunk;
+      const auto end = nevent * (k + 1) / nchunk;
+      if (variances) {
+        const auto vars = weights.variances<T>().as_span();
+        for (auto i = begin; i < end; ++i)
+          if (const auto bin = index[i]; bin >= 0) {
+            out[2 * bin] += values[i];
+            out[2 * bin + 1] += vars[i];
+          }
+      } else {
+        for (auto i = begin; i < end; ++i)
+          if (const auto bin = index[i]; bin >= 0)
+            out[bin] += values[i];
+      }
+    }
+  };
+  core::parallel::parallel_for(core::parallel::blocked_range(0, nchunk, 1),
+                               accumulate);
+  for (scipp::index k = 1; k < nchunk; ++k)
+    std::transform(partial.begin(), partial.begin() + stride * nbin,
+                   partial.begin() + k * stride * nbin, partial.begin(),
+                   std::plus<>());
+  Variable result = variances ? makeVariable<T>(dims, weights.unit(),
+                                                Values{}, Variances{})
+                              : makeVariable<T>(dims, weights.unit());
+  auto out_values = result.values<T>().as_span();
+  for (scipp::index bin = 0; bin < nbin; ++bin)
+    out_values[bin] = static_cast<T>(partial[stride * bin]);
+  if (variances) {
+    auto out_variances = result.variances<T>().as_span();
+    for (scipp::index bin = 0; bin < nbin; ++bin)
+      out_variances[bin] = static_cast<T>(partial[2 * bin + 1]);
+  }
+  return result;
+}
+
+template <class Index>
+Variable histogram_flat(const Variable &indices, const Variable &weights,
+                        const Dimensions &dims) {
+  if (weights.dtype() == dtype<double>)
+    return histogram_flat<double, Index>(indices, weights, dims);
+  if (weights.dtype() == dtype<float>)
+    return histogram_flat<float, Index>(indices, weights, dims);
+  throw except::TypeError("Cannot histogram event weights of type " +
+                          to_string(weights.dtype()) + '.');
+}
+} // namespace
+
+/// Return histogram of a table of events along all dims of the given edges.
+///
+/// Unlike histogramming the result of `bin`, the events are not reordered or
+/// copied. Instead the flat output bin of every event is computed from its
+/// coords, and the weights are accumulated directly into the dense result. The
+/// first edges define the outermost dim of the result.
+DataArray histogram(const DataArray &events,
+                    const std::vector<Variable> &binEdges) {
+  if (is_bins(events))
+    throw except::TypeError(
+        "Multi-dimensional histogram requires a dense table of events, "
+        "histogram binned data along one dim at a time.");
+  if (events.dims().ndim() != 1)
+    throw except::DimensionError(
+        "Multi-dimensional histogram requires a 1-D table of events, got " +
+        to_string(events.dims()) + '.');
+  const auto event_dim = events.dim();
+  Dimensions dims;
+  for (const auto &edges : binEdges) {
+    if (edges.dims().ndim() != 1)
+      throw except::BinEdgeError(
+          "Bin edges of multi-dimensional histogram must be 1-D.");
+    const auto dim = edges.dim();
+    if (edges.dims()[dim] < 2)
+      throw except::BinEdgeError("Bin edges must have at least two elements.");
+    dims.addInner(dim, edges.dims()[dim] - 1);
+  }
+  // The table of events is never copied, so the indices are the largest
+  // temporary. Use 32-bit indices if possible, as done by `bin`.
+  auto indices = dims.volume() > std::numeric_limits<int32_t>::max()
+                     ? makeVariable<int64_t>(events.dims())
+                     : makeVariable<int32_t>(events.dims());
+  for (const auto &edges : binEdges) {
+    const auto dim = edges.dim();
+    const auto properties = edge_properties(edges, dim);
+    if (!properties.ascending)
+      throw except::BinEdgeError("Bin edges of histogram must be sorted.");
+    update_indices_by_binning(indices, events.coords()[dim], edges,
+                              properties);
+  }
+  const auto weights = as_contiguous(masked_data(events, event_dim), event_dim);
+  DataArray result(indices.dtype() == dtype<int64_t>
+                       ? histogram_flat<int64_t>(indices, weights, dims)
+                       : histogram_flat<int32_t>(indices, weights, dims));
+  result.setName(events.name());
+  for (const auto &[dim, coord] : events.coords())
+    if (!coord.dims().contains(event_dim) && !dims.contains(dim))
+      result.coords().set(dim, coord);
+  for (const auto &[name, mask] : events.masks())
+    if (!mask.dims().contains(event_dim))
+      result.masks().set(name, copy(mask));
+  for (const auto &edges : binEdges)
+    result.coords().set(edges.dim(), edges);
+  return result;
+}
+
 Dataset histogram(const Dataset &dataset, const Variable &binEdges) {
   return apply_to_items(
       dataset,
@@ -91,6 +235,56 @@ Dataset histogram(const Dataset &dataset, const Variable &binEdges) {
       binEdges.dims().inner(), binEdges);
 }
 
+HistogramAccumulator::HistogramAccumulator(const Variable &edges)
+    : m_edges(copy(edges)) {
+  const auto dim = m_edges.dims().inner();
+  if (m_edges.dims()[dim] < 2)
+    throw except::BinEdgeError("Bin edges must have at least two elements.");
+  if (!allsorted(m_edges, dim))
+    throw except::BinEdgeError("Bin edges of histogram must be sorted.");
+}
+
+/// Add the histogram of `chunk` to the accumulated histogram.
+///
+/// Coords and masks of the result are those of the histogram of the first
+/// chunk. Histograms of all chunks must have the same dims.
+void HistogramAccumulator::add(const DataArray &chunk) {
+  const auto hist = histogram(chunk, m_edges);
+  const std::lock_guard lock(m_mutex);
+  if (m_histogram) {
+    core::expect::equals(m_histogram->dims(), hist.dims());
+    auto data = m_histogram->data();
+    data += hist.data();
+  } else {
+    m_histogram = hist;
+  }
+  ++m_chunks;
+}
+
+/// Return a copy of the histogram of all chunks added so far.
+///
+/// Throws if no chunk has been added, since the shape of the histogram is then
+/// unknown.
+DataArray HistogramAccumulator::snapshot() const {
+  const std::lock_guard lock(m_mutex);
+  if (!m_histogram)
+    throw std::runtime_error("No chunks have been added to the accumulator.");
+  return copy(*m_histogram);
+}
+
+/// Discard the accumulated histogram.
+void HistogramAccumulator::reset() {
+  const std::lock_guard lock(m_mutex);
+  m_histogram.reset();
+  m_chunks = 0;
+}
+
+/// Return the number of chunks added since construction or the last reset.
+scipp::index HistogramAccumulator::chunks() const {
+  const std::lock_guard lock(m_mutex);
+  return m_chunks;
+}
+
 /// Return the dimensions of the given data array that have an "bin edge"
 /// coordinate.
 std::set<Dim> edge_dimensions(const DataArray &a) {
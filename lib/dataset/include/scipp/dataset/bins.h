@@ -52,6 +52,8 @@ namespace scipp::dataset::buckets {
 
 SCIPP_DATASET_EXPORT void append(Variable &var0, const Variable &var1);
 SCIPP_DATASET_EXPORT void append(DataArray &a, const DataArray &b);
+SCIPP_DATASET_EXPORT void reserve(Variable &var, const Variable &capacity);
+SCIPP_DATASET_EXPORT void reserve(DataArray &array, const Variable &capacity);
 
 [[nodiscard]] SCIPP_DATASET_EXPORT Variable histogram(const Variable &data,
                                                       const Variable &binEdges);
@@ -120,6 +120,11 @@ SCIPP_DATASET_EXPORT bool operator!=(const DataArray &a, const DataArray &b);
 [[nodiscard]] SCIPP_DATASET_EXPORT DataArray
 copy(const DataArray &array, AttrPolicy attrPolicy = AttrPolicy::Keep);
 
+[[nodiscard]] SCIPP_DATASET_EXPORT core::MemoryUsage
+memory_usage(const DataArray &array, variable::BufferSet &seen);
+[[nodiscard]] SCIPP_DATASET_EXPORT core::MemoryUsage
+memory_usage(const DataArray &array);
+
 } // namespace scipp::dataset
 
 namespace scipp {
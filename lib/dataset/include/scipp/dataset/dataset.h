@@ -223,6 +223,11 @@ copy(const Dataset &dataset, Dataset &out,
 copy(const Dataset &dataset, Dataset &&out,
      const AttrPolicy attrPolicy = AttrPolicy::Keep);
 
+[[nodiscard]] SCIPP_DATASET_EXPORT core::MemoryUsage
+memory_usage(const Dataset &dataset, variable::BufferSet &seen);
+[[nodiscard]] SCIPP_DATASET_EXPORT core::MemoryUsage
+memory_usage(const Dataset &dataset);
+
 SCIPP_DATASET_EXPORT Dataset operator+(const Dataset &lhs, const Dataset &rhs);
 SCIPP_DATASET_EXPORT Dataset operator+(const Dataset &lhs,
                                        const DataArray &rhs);
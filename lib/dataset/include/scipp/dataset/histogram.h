@@ -5,8 +5,11 @@
 #pragma once
 
 #include <algorithm>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <tuple>
+#include <vector>
 
 #include "scipp/dataset/dataset.h"
 
@@ -16,6 +19,33 @@ SCIPP_DATASET_EXPORT DataArray histogram(const DataArray &events,
                                          const Variable &binEdges);
 SCIPP_DATASET_EXPORT Dataset histogram(const Dataset &dataset,
                                        const Variable &bins);
+SCIPP_DATASET_EXPORT DataArray
+histogram(const DataArray &events, const std::vector<Variable> &binEdges);
+
+/// Accumulator of histograms of event chunks, e.g., for live data reduction.
+///
+/// Chunks may be added concurrently from multiple threads. Every chunk is
+/// histogrammed independently and only the summation into the running
+/// histogram is serialized. Snapshots share the buffers of the running
+/// histogram until the next chunk is added, so taking a snapshot does not block
+/// ingestion for longer than adding a chunk.
+class SCIPP_DATASET_EXPORT HistogramAccumulator {
+public:
+  explicit HistogramAccumulator(const Variable &edges);
+
+  void add(const DataArray &chunk);
+  [[nodiscard]] DataArray snapshot() const;
+  void reset();
+
+  [[nodiscard]] const Variable &edges() const noexcept { return m_edges; }
+  [[nodiscard]] scipp::index chunks() const;
+
+private:
+  Variable m_edges;
+  mutable std::mutex m_mutex;
+  std::optional<DataArray> m_histogram;
+  scipp::index m_chunks{0};
+};
 
 SCIPP_DATASET_EXPORT std::set<Dim> edge_dimensions(const DataArray &a);
 SCIPP_DATASET_EXPORT Dim edge_dimension(const DataArray &a);
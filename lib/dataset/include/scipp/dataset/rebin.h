@@ -5,6 +5,7 @@
 #pragma once
 
 #include "scipp/dataset/dataset.h"
+#include "scipp/variable/rebin.h"
 
 namespace scipp::dataset {
 
@@ -15,4 +16,11 @@ namespace scipp::dataset {
                                                  const Dim dim,
                                                  const Variable &coord);
 
+[[nodiscard]] SCIPP_DATASET_EXPORT DataArray
+resample(const DataArray &a, const Dim dim, const Variable &coord,
+         const variable::ResampleMode mode);
+[[nodiscard]] SCIPP_DATASET_EXPORT Dataset
+resample(const Dataset &d, const Dim dim, const Variable &coord,
+         const variable::ResampleMode mode);
+
 } // namespace scipp::dataset
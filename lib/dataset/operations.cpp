@@ -104,6 +104,45 @@ Dataset copy(const Dataset &dataset, Dataset &&out,
   return std::move(out);
 }
 
+namespace {
+template <class Dict>
+void add_memory_usage(core::MemoryUsage &usage, const Dict &dict,
+                      variable::BufferSet &seen) {
+  for (const auto &[key, var] : dict)
+    usage += memory_usage(var, seen);
+}
+} // namespace
+
+/// Return memory of buffers of `array` not contained in `seen`, adding them to
+/// `seen`. Coords and masks shared with other data arrays are counted once.
+core::MemoryUsage memory_usage(const DataArray &array,
+                               variable::BufferSet &seen) {
+  auto usage = memory_usage(array.data(), seen);
+  add_memory_usage(usage, array.coords(), seen);
+  add_memory_usage(usage, array.masks(), seen);
+  add_memory_usage(usage, array.attrs(), seen);
+  return usage;
+}
+
+core::MemoryUsage memory_usage(const DataArray &array) {
+  variable::BufferSet seen;
+  return memory_usage(array, seen);
+}
+
+core::MemoryUsage memory_usage(const Dataset &dataset,
+                               variable::BufferSet &seen) {
+  core::MemoryUsage usage;
+  add_memory_usage(usage, dataset.coords(), seen);
+  for (const auto &item : dataset)
+    usage += memory_usage(item, seen);
+  return usage;
+}
+
+core::MemoryUsage memory_usage(const Dataset &dataset) {
+  variable::BufferSet seen;
+  return memory_usage(dataset, seen);
+}
+
 /// Return data of data array, applying masks along dim if applicable.
 ///
 /// Only in the latter case a copy is returned.
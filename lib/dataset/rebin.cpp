@@ -10,19 +10,34 @@
 namespace scipp::dataset {
 
 DataArray rebin(const DataArray &a, const Dim dim, const Variable &coord) {
-  auto rebinned = apply_to_data_and_drop_dim(
-      a, [](auto &&... _) { return rebin(_...); }, dim, a.coords()[dim], coord);
+  return resample(a, dim, coord, variable::ResampleMode::Sum);
+}
+
+Dataset rebin(const Dataset &d, const Dim dim, const Variable &coord) {
+  return resample(d, dim, coord, variable::ResampleMode::Sum);
+}
+
+/// Resample data along `dim` to the new bin edges `coord`.
+///
+/// Masks depending on `dim` are rebinned as in `rebin`, i.e., a new bin is
+/// masked if any overlapping old bin is masked.
+DataArray resample(const DataArray &a, const Dim dim, const Variable &coord,
+                   const variable::ResampleMode mode) {
+  auto resampled = apply_to_data_and_drop_dim(
+      a, [](auto &&... _) { return resample(_...); }, dim, a.coords()[dim],
+      coord, mode);
   for (auto &&[name, mask] : a.masks()) {
     if (mask.dims().contains(dim))
-      rebinned.masks().set(name, rebin(mask, dim, a.coords()[dim], coord));
+      resampled.masks().set(name, rebin(mask, dim, a.coords()[dim], coord));
   }
-  rebinned.coords().set(dim, coord);
-  return rebinned;
+  resampled.coords().set(dim, coord);
+  return resampled;
 }
 
-Dataset rebin(const Dataset &d, const Dim dim, const Variable &coord) {
+Dataset resample(const Dataset &d, const Dim dim, const Variable &coord,
+                 const variable::ResampleMode mode) {
   return apply_to_items(
-      d, [](auto &&... _) { return rebin(_...); }, dim, coord);
+      d, [](auto &&... _) { return resample(_...); }, dim, coord, mode);
 }
 
 } // namespace scipp::dataset
@@ -10,6 +10,7 @@
 #include "scipp/dataset/histogram.h"
 #include "scipp/dataset/string.h"
 #include "scipp/variable/arithmetic.h"
+#include "scipp/variable/astype.h"
 #include "scipp/variable/comparison.h"
 #include "scipp/variable/misc_operations.h"
 #include "scipp/variable/reduction.h"
@@ -120,6 +121,31 @@ TEST(BinGroupTest, 1d) {
             expected.slice({Dim::Row, 4}));
 }
 
+TEST(BinScatterTest, all_columns_copied_in_input_order) {
+  const Dimensions dims(Dim::Row, 5);
+  const auto data = makeVariable<double>(dims, Values{1, 2, 3, 4, 5},
+                                         Variances{5, 4, 3, 2, 1});
+  const auto x = makeVariable<double>(dims, Values{3, 1, 2, 0, 3});
+  const auto label =
+      makeVariable<std::string>(dims, Values{"a", "b", "c", "d", "e"});
+  const auto mask =
+      makeVariable<bool>(dims, Values{true, false, false, true, false});
+  const auto table =
+      DataArray(data, {{Dim::X, x}, {Dim("label"), label}}, {{"mask", mask}});
+  const auto edges =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{0, 2, 4});
+  const auto binned = bin(table, {edges});
+  const auto &[indices, dim, buffer] = binned.data().constituents<DataArray>();
+  static_cast<void>(indices);
+  static_cast<void>(dim);
+  // Order of events in each bin is their order in the input.
+  const std::vector<scipp::index> order{1, 3, 0, 2, 4};
+  auto expected = copy(table.slice({Dim::Row, 0, 5}));
+  for (scipp::index i = 0; i < 5; ++i)
+    copy(table.slice({Dim::Row, order[i]}), expected.slice({Dim::Row, i}));
+  EXPECT_EQ(buffer, expected);
+}
+
 class BinTest : public ::testing::TestWithParam<DataArray> {
 protected:
   Variable groups = makeVariable<int64_t>(Dims{Dim("group")}, Shape{5},
@@ -206,6 +232,47 @@ TEST_P(BinTest, 2d_drop_out_of_range_linspace) {
   EXPECT_EQ(xy, x_then_y);
 }
 
+TEST_P(BinTest, 3d_linspace) {
+  auto table = GetParam();
+  const auto edges_z =
+      makeVariable<double>(Dims{Dim::Z}, Shape{3}, Values{0.0, 0.5, 1.0});
+  table.coords().set(Dim::Z, values(table.data()));
+  const auto xyz = bin(table, {edges_x, edges_y, edges_z});
+  EXPECT_EQ(xyz, bin(bin(bin(table, {edges_x}), {edges_y}), {edges_z}));
+}
+
+TEST_P(BinTest, 2d_linspace_float) {
+  auto table = GetParam();
+  table.coords().set(Dim::X, astype(table.coords()[Dim::X], dtype<float>));
+  table.coords().set(Dim::Y, astype(table.coords()[Dim::Y], dtype<float>));
+  const auto edges_x_float = astype(edges_x, dtype<float>);
+  const auto edges_y_float = astype(edges_y, dtype<float>);
+  const auto xy = bin(table, {edges_x_float, edges_y_float});
+  EXPECT_EQ(xy, bin(bin(table, {edges_x_float}), {edges_y_float}));
+}
+
+TEST_P(BinTest, logspace) {
+  auto table = GetParam();
+  // Shift coord to [0.5, 4.5) such that it can be binned with log-spaced edges.
+  table.coords().set(Dim::X, table.coords()[Dim::X] + 2.5 * units::one);
+  const auto edges =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{0.5, 1.0, 2.0, 4.0});
+  ASSERT_TRUE(variable::edge_properties(edges, Dim::X).logspace);
+  const auto binned = bin(table, {edges});
+  std::vector<scipp::index> sizes(3);
+  const auto e = edges.values<double>();
+  for (const auto x : table.coords()[Dim::X].values<double>()) {
+    const auto it = std::upper_bound(e.begin(), e.end(), x);
+    if (it != e.begin() && it != e.end())
+      ++sizes[std::distance(e.begin(), it) - 1];
+  }
+  EXPECT_EQ(bin_sizes(binned.data()),
+            makeVariable<scipp::index>(Dims{Dim::X}, Shape{3}, Values(sizes)));
+  const auto coarse =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{0.5, 2.0, 8.0});
+  EXPECT_EQ(bin(bin(table, {coarse}), {edges}), binned);
+}
+
 TEST_P(BinTest, 2d_drop_out_of_range) {
   auto edges_x_drop = edges_x.slice({Dim::X, 1, 4});
   edges_x_drop.values<double>()[0] += 0.001;
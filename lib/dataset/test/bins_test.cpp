@@ -13,6 +13,7 @@
 #include "scipp/variable/bins.h"
 #include "scipp/variable/math.h"
 #include "scipp/variable/operations.h"
+#include "scipp/variable/reduction.h"
 #include "scipp/variable/variable_factory.h"
 
 using namespace scipp;
@@ -416,6 +417,73 @@ TEST_F(DataArrayBinsPlusMinusTest, minus_equals) {
   EXPECT_EQ(out, buckets::concatenate(a, -b));
 }
 
+TEST_F(DataArrayBinsPlusMinusTest, reserve_keeps_events) {
+  auto out = copy(a);
+  buckets::reserve(out, makeVariable<scipp::index>(Values{20}));
+  EXPECT_EQ(out, a);
+  const auto &[indices, dim, buffer] = out.data().constituents<DataArray>();
+  EXPECT_EQ(buffer.dims()[dim], 40);
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, append_into_reserved) {
+  auto out = copy(a);
+  buckets::reserve(out, makeVariable<scipp::index>(Values{40}));
+  const auto buffer_before =
+      std::get<2>(out.data().constituents<DataArray>()).data();
+  buckets::append(out, b);
+  EXPECT_EQ(out, buckets::concatenate(a, b));
+  buckets::append(out, out);
+  EXPECT_EQ(out, buckets::concatenate(buckets::concatenate(a, b),
+                                      buckets::concatenate(a, b)));
+  // Events were written into reserved space, no reallocation.
+  EXPECT_TRUE(std::get<2>(out.data().constituents<DataArray>())
+                  .data()
+                  .is_same(buffer_before));
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, append_exceeding_reserved_grows) {
+  auto out = copy(a);
+  buckets::reserve(out, makeVariable<scipp::index>(Values{4}));
+  auto expected = copy(a);
+  for (scipp::index i = 0; i < 4; ++i) {
+    buckets::append(out, b);
+    expected = buckets::concatenate(expected, b);
+    EXPECT_EQ(out, expected);
+  }
+  // Layout has spare capacity after growing, beyond the events in the bins.
+  const auto &[indices, dim, buffer] = out.data().constituents<DataArray>();
+  EXPECT_GT(buffer.dims()[dim],
+            sum(bin_sizes(out.data())).value<scipp::index>());
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, append_in_place_does_not_affect_copies) {
+  auto out = copy(a);
+  buckets::reserve(out, makeVariable<scipp::index>(Values{20}));
+  const auto original = copy(out);
+  buckets::append(out, b);
+  EXPECT_EQ(original, a);
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, append_is_seen_by_shallow_copies) {
+  auto out = copy(a);
+  const auto shallow = out.data();
+  buckets::append(out, b); // reallocates
+  EXPECT_EQ(shallow, buckets::concatenate(a, b).data());
+  buckets::reserve(out, makeVariable<scipp::index>(Values{40}));
+  EXPECT_EQ(shallow, out.data());
+  buckets::append(out, b); // writes into reserved space
+  EXPECT_EQ(shallow,
+            buckets::concatenate(buckets::concatenate(a, b), b).data());
+}
+
+TEST_F(DataArrayBinsPlusMinusTest, append_to_slice_throws) {
+  auto out = copy(a);
+  auto slice = out.data().slice({Dim::Y, 0});
+  EXPECT_THROW(buckets::append(slice, b.data().slice({Dim::Y, 0})),
+               except::SliceError);
+  EXPECT_EQ(out, a);
+}
+
 class DatasetBinsTest : public ::testing::Test {
 protected:
   Dimensions dims{Dim::Y, 2};
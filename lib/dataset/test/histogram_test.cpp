@@ -5,6 +5,9 @@
 #include <gtest/gtest-matchers.h>
 #include <gtest/gtest.h>
 
+#include <thread>
+
+#include "scipp/core/parallel.h"
 #include "scipp/dataset/bin.h"
 #include "scipp/dataset/bins.h"
 #include "scipp/dataset/dataset.h"
@@ -12,6 +15,7 @@
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/comparison.h"
 #include "scipp/variable/shape.h"
+#include "scipp/variable/util.h"
 
 using namespace scipp;
 using namespace scipp::dataset;
@@ -278,6 +282,290 @@ TEST(HistogramTest, dense_vs_binned) {
   }
 }
 
+/// Base for tests with more threads than cores, which is fine and ensures that
+/// large tables are split into chunks.
+class HistogramThreadedTest : public ::testing::Test {
+protected:
+  HistogramThreadedTest() { core::parallel::set_max_threads(8); }
+  ~HistogramThreadedTest() override { core::parallel::reset_max_threads(); }
+};
+
+class HistogramLargeTableTest : public HistogramThreadedTest {
+protected:
+  HistogramLargeTableTest() {
+    std::vector<double> x(size);
+    for (scipp::index i = 0; i < size; ++i)
+      x[i] = static_cast<double>(i % 1000) + 0.5;
+    const auto coord =
+        makeVariable<double>(Dims{Dim::Event}, Shape{size}, Values(x));
+    const std::vector<double> weights(size, 1.0);
+    table = DataArray(makeVariable<double>(Dims{Dim::Event}, Shape{size},
+                                           units::counts, Values(weights),
+                                           Variances(weights)),
+                      {{Dim::X, coord}});
+  }
+
+  /// Return the histogram of `table` with given edges, computed serially.
+  DataArray expected(const Variable &edges) const {
+    std::vector<double> counts(edges.dims().volume() - 1);
+    const auto e = edges.values<double>();
+    for (scipp::index i = 0; i < size; ++i) {
+      const auto x = static_cast<double>(i % 1000) + 0.5;
+      const auto it = std::upper_bound(e.begin(), e.end(), x);
+      if (it != e.begin() && it != e.end())
+        ++counts[std::distance(e.begin(), it) - 1];
+    }
+    return DataArray(
+        makeVariable<double>(Dims{Dim::X}, Shape{counts.size()}, units::counts,
+                             Values(counts), Variances(counts)),
+        {{Dim::X, edges}});
+  }
+
+  static constexpr scipp::index size = 400000;
+  DataArray table;
+};
+
+TEST_F(HistogramLargeTableTest, linspace_edges) {
+  const auto edges = makeVariable<double>(
+      Dims{Dim::X}, Shape{11},
+      Values{0, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000});
+  EXPECT_EQ(histogram(table, edges), expected(edges));
+}
+
+TEST_F(HistogramLargeTableTest, sorted_edges) {
+  const auto edges = makeVariable<double>(Dims{Dim::X}, Shape{5},
+                                          Values{-1, 100, 250, 251, 900});
+  EXPECT_EQ(histogram(table, edges), expected(edges));
+}
+
+TEST_F(HistogramLargeTableTest, logspace_edges) {
+  const auto edges = makeVariable<double>(
+      Dims{Dim::X}, Shape{11},
+      Values{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024});
+  EXPECT_EQ(histogram(table, edges), expected(edges));
+}
+
+TEST_F(HistogramLargeTableTest, single_bin) {
+  const auto edges = makeVariable<double>(Dims{Dim::X}, Shape{4},
+                                          Values{0, 100, 250, 1000});
+  const auto binned = DataArray(make_bins(
+      makeVariable<scipp::index_pair>(Values{scipp::index_pair{0, size}}),
+      Dim::Event, copy(table)));
+  EXPECT_EQ(histogram(binned, edges), expected(edges));
+}
+
+class HistogramMultiDimTest : public HistogramThreadedTest {
+protected:
+  HistogramMultiDimTest() {
+    std::vector<double> x(size);
+    std::vector<double> y(size);
+    std::vector<double> z(size);
+    std::vector<double> weights(size);
+    for (scipp::index i = 0; i < size; ++i) {
+      x[i] = static_cast<double>(i % 97) * 0.1 - 1.0;
+      y[i] = static_cast<double>(i % 89) * 0.1 - 1.0;
+      z[i] = static_cast<double>(i % 1000) + 0.5;
+      // Integer weights make the result independent of the summation order.
+      weights[i] = static_cast<double>(1 + i % 3);
+    }
+    const Dimensions dims(Dim::Event, size);
+    table = DataArray(makeVariable<double>(dims, units::counts,
+                                           Values(weights), Variances(weights)),
+                      {{Dim::X, makeVariable<double>(dims, Values(x))},
+                       {Dim::Y, makeVariable<double>(dims, Values(y))},
+                       {Dim::Z, makeVariable<double>(dims, Values(z))}});
+  }
+
+  /// Return the histogram of `table` computed by summing the result of `bin`.
+  DataArray expected(const std::vector<Variable> &edges) const {
+    const auto binned = bin(table, edges);
+    DataArray hist(bins_sum(binned.data()));
+    for (const auto &var : edges)
+      hist.coords().set(var.dim(), var);
+    return hist;
+  }
+
+  static constexpr scipp::index size = 400000;
+  Variable edges_x = makeVariable<double>(
+      Dims{Dim::X}, Shape{6}, Values{-1.0, -0.5, 0.0, 0.5, 1.0, 2.0});
+  Variable edges_y = makeVariable<double>(Dims{Dim::Y}, Shape{5},
+                                          Values{-0.5, 0.0, 0.5, 1.0, 1.5});
+  Variable edges_z = makeVariable<double>(
+      Dims{Dim::Z}, Shape{11},
+      Values{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024});
+  DataArray table;
+};
+
+TEST_F(HistogramMultiDimTest, matches_histogram_of_bin) {
+  EXPECT_EQ(histogram(table, {edges_x, edges_y}),
+            expected({edges_x, edges_y}));
+  EXPECT_EQ(histogram(table, {edges_y, edges_x}),
+            expected({edges_y, edges_x}));
+  EXPECT_EQ(histogram(table, {edges_x, edges_y, edges_z}),
+            expected({edges_x, edges_y, edges_z}));
+}
+
+TEST_F(HistogramMultiDimTest, single_edges_matches_1d_histogram) {
+  EXPECT_EQ(histogram(table, std::vector{edges_z}), histogram(table, edges_z));
+}
+
+TEST_F(HistogramMultiDimTest, without_variances) {
+  table.data().setVariances(Variable{});
+  EXPECT_EQ(histogram(table, {edges_x, edges_z}),
+            expected({edges_x, edges_z}));
+}
+
+TEST_F(HistogramMultiDimTest, many_bins) {
+  // More bins than events per thread, the events are not split into chunks.
+  const auto edges = linspace(-1.0 * units::one, 1.0 * units::one, Dim::Y,
+                              20001);
+  EXPECT_EQ(histogram(table, {edges_x, edges}), expected({edges_x, edges}));
+}
+
+TEST_F(HistogramMultiDimTest, fail_unsorted_edges) {
+  const auto unsorted =
+      makeVariable<double>(Dims{Dim::Y}, Shape{3}, Values{1.0, 0.0, 2.0});
+  EXPECT_THROW(histogram(table, {edges_x, unsorted}), except::BinEdgeError);
+}
+
+TEST_F(HistogramMultiDimTest, fail_duplicate_dim) {
+  EXPECT_THROW(histogram(table, {edges_x, edges_x}), except::DimensionError);
+}
+
+TEST_F(HistogramMultiDimTest, fail_missing_coord) {
+  table.coords().erase(Dim::Y);
+  EXPECT_THROW(histogram(table, {edges_x, edges_y}), except::NotFoundError);
+}
+
+TEST_F(HistogramMultiDimTest, fail_binned) {
+  const auto binned = bin(table, {edges_x});
+  EXPECT_THROW(histogram(binned, {edges_x, edges_y}), except::TypeError);
+}
+
+TEST(HistogramTest, multi_dim_masks_and_scalar_coords) {
+  const Dimensions dims(Dim::Event, 4);
+  DataArray table(
+      makeVariable<double>(dims, units::counts, Values{1, 2, 3, 4},
+                           Variances{1, 2, 3, 4}),
+      {{Dim::X, makeVariable<double>(dims, Values{0.5, 1.5, 1.5, 3.0})},
+       {Dim::Y, makeVariable<double>(dims, Values{0.5, 0.5, 1.5, 0.5})},
+       {Dim("scalar"), makeVariable<double>(Values{1.2})}},
+      {{"event", makeVariable<bool>(dims, Values{false, true, false, false})},
+       {"scalar", makeVariable<bool>(Values{false})}});
+  const auto edges_x =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{0, 1, 2});
+  const auto edges_y =
+      makeVariable<double>(Dims{Dim::Y}, Shape{3}, Values{0, 1, 2});
+  DataArray expected(
+      makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{2, 2}, units::counts,
+                           Values{1, 0, 0, 3}, Variances{1, 0, 0, 3}),
+      {{Dim::X, edges_x},
+       {Dim::Y, edges_y},
+       {Dim("scalar"), makeVariable<double>(Values{1.2})}},
+      {{"scalar", makeVariable<bool>(Values{false})}});
+  EXPECT_EQ(histogram(table, {edges_x, edges_y}), expected);
+}
+
+class HistogramAccumulatorTest : public ::testing::Test {
+protected:
+  DataArray make_chunk(const scipp::index i) const {
+    const auto x = makeVariable<double>(
+        Dims{Dim::Event}, Shape{4},
+        Values{0.1 * i, 1.5 + 0.1 * i, 2.5, 10.0 + i});
+    return DataArray(makeVariable<double>(Dims{Dim::Event}, Shape{4},
+                                          units::counts, Values{1, 2, 3, 4},
+                                          Variances{1, 2, 3, 4}),
+                     {{Dim::X, x}});
+  }
+  Variable edges =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{0.0, 1.0, 2.0, 3.0});
+};
+
+TEST_F(HistogramAccumulatorTest, unsorted_edges_fail) {
+  EXPECT_THROW(HistogramAccumulator(makeVariable<double>(
+                   Dims{Dim::X}, Shape{3}, Values{0.0, 2.0, 1.0})),
+               except::BinEdgeError);
+}
+
+TEST_F(HistogramAccumulatorTest, snapshot_without_chunks_fails) {
+  HistogramAccumulator accumulator(edges);
+  EXPECT_EQ(accumulator.chunks(), 0);
+  EXPECT_THROW_DISCARD(accumulator.snapshot(), std::runtime_error);
+}
+
+TEST_F(HistogramAccumulatorTest, add) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(make_chunk(0));
+  EXPECT_EQ(accumulator.snapshot(), histogram(make_chunk(0), edges));
+  accumulator.add(make_chunk(1));
+  EXPECT_EQ(accumulator.chunks(), 2);
+  EXPECT_EQ(accumulator.snapshot().data(),
+            histogram(make_chunk(0), edges).data() +
+                histogram(make_chunk(1), edges).data());
+}
+
+TEST_F(HistogramAccumulatorTest, add_binned) {
+  HistogramAccumulator accumulator(edges);
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{2},
+      Values{scipp::index_pair{0, 1}, scipp::index_pair{1, 4}});
+  const DataArray binned(make_bins(indices, Dim::Event, make_chunk(0)));
+  accumulator.add(binned);
+  accumulator.add(binned);
+  const auto hist = histogram(binned, edges).data();
+  EXPECT_EQ(accumulator.snapshot().data(), hist + hist);
+}
+
+TEST_F(HistogramAccumulatorTest, add_mismatching_dims_fails) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(make_chunk(0));
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{1}, Values{scipp::index_pair{0, 4}});
+  EXPECT_THROW(accumulator.add(DataArray(
+                   make_bins(indices, Dim::Event, make_chunk(0)))),
+               except::DimensionError);
+}
+
+TEST_F(HistogramAccumulatorTest, snapshot_unaffected_by_later_chunks) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(make_chunk(0));
+  const auto snapshot = accumulator.snapshot();
+  const auto expected = copy(snapshot);
+  accumulator.add(make_chunk(1));
+  EXPECT_EQ(snapshot, expected);
+  EXPECT_NE(accumulator.snapshot(), expected);
+}
+
+TEST_F(HistogramAccumulatorTest, reset) {
+  HistogramAccumulator accumulator(edges);
+  accumulator.add(make_chunk(0));
+  accumulator.reset();
+  EXPECT_EQ(accumulator.chunks(), 0);
+  accumulator.add(make_chunk(1));
+  EXPECT_EQ(accumulator.snapshot(), histogram(make_chunk(1), edges));
+}
+
+TEST_F(HistogramAccumulatorTest, concurrent_add) {
+  HistogramAccumulator accumulator(edges);
+  std::vector<std::thread> producers;
+  for (scipp::index thread = 0; thread < 4; ++thread)
+    producers.emplace_back([&]() {
+      for (scipp::index i = 0; i < 10; ++i) {
+        accumulator.add(make_chunk(i));
+        static_cast<void>(accumulator.snapshot());
+      }
+    });
+  for (auto &producer : producers)
+    producer.join();
+  EXPECT_EQ(accumulator.chunks(), 40);
+  auto expected = histogram(make_chunk(0), edges).data();
+  for (scipp::index i = 1; i < 10; ++i)
+    expected += histogram(make_chunk(i), edges).data();
+  // Sums of integers are exact, so the order of chunks does not matter.
+  EXPECT_EQ(accumulator.snapshot().data(),
+            expected + expected + expected + expected);
+}
+
 struct Histogram1DTest : public ::testing::Test {
 protected:
   Histogram1DTest() {
@@ -4,12 +4,16 @@
 #include <gtest/gtest-matchers.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
+
 #include "scipp/dataset/rebin.h"
 #include "scipp/dataset/shape.h"
 #include "scipp/variable/astype.h"
 #include "scipp/variable/rebin.h"
 #include "scipp/variable/shape.h"
 
+#include "test_macros.h"
+
 using namespace scipp;
 using namespace scipp::dataset;
 
@@ -236,3 +240,106 @@ TEST(RebinWithMaskTest, preserves_unrelated_mask) {
   ASSERT_EQ(ds["data_xy"].masks().size(), 2);
   ASSERT_EQ(ds["data_xy"].masks()["mask_y"].dims(), Dimensions(Dim::Y, 5));
 }
+
+class ResampleTest : public RebinTest {
+protected:
+  Variable edges =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 3, 5});
+};
+
+TEST_F(ResampleTest, sum_is_rebin) {
+  EXPECT_EQ(resample(array, Dim::X, edges, variable::ResampleMode::Sum),
+            rebin(array, Dim::X, edges));
+}
+
+TEST_F(ResampleTest, mean) {
+  DataArray expected(makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                          units::counts,
+                                          Values{1.5, 3.5, 5.5, 7.5}),
+                     {{Dim::X, edges}, {Dim::Y, y}});
+  EXPECT_EQ(resample(array, Dim::X, edges, variable::ResampleMode::Mean),
+            expected);
+  EXPECT_EQ(resample(transpose(array), Dim::X, edges,
+                     variable::ResampleMode::Mean),
+            transpose(expected));
+}
+
+TEST_F(ResampleTest, mean_with_variances) {
+  DataArray expected(makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                          units::counts,
+                                          Values{1.5, 3.5, 5.5, 7.5},
+                                          Variances{4.75, 5.75, 6.75, 7.75}),
+                     {{Dim::X, edges}, {Dim::Y, y}});
+  EXPECT_EQ(resample(array_with_variances, Dim::X, edges,
+                     variable::ResampleMode::Mean),
+            expected);
+}
+
+TEST_F(ResampleTest, mean_unaligned_edges) {
+  const auto unaligned =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1.0, 2.5, 5.0});
+  DataArray expected(
+      makeVariable<double>(
+          Dims{Dim::Y, Dim::X}, Shape{2, 2}, units::counts,
+          Values{2.0 / 1.5, 8.0 / 2.5, 8.0 / 1.5, 18.0 / 2.5}),
+      {{Dim::X, unaligned}, {Dim::Y, y}});
+  EXPECT_EQ(resample(array, Dim::X, unaligned, variable::ResampleMode::Mean),
+            expected);
+}
+
+TEST_F(ResampleTest, mean_ignores_parts_outside_old_edges) {
+  const auto wide =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{-1.0, 0.0, 3.0, 9.0});
+  const auto result =
+      resample(array, Dim::X, wide, variable::ResampleMode::Mean);
+  const auto values = result.values<double>();
+  EXPECT_TRUE(std::isnan(values[0]));
+  EXPECT_EQ(values[1], 1.5);
+  EXPECT_EQ(values[2], 3.5);
+}
+
+TEST_F(ResampleTest, mean_of_int_is_double) {
+  DataArray array_int(astype(counts, dtype<int64_t>),
+                      {{Dim::X, x}, {Dim::Y, y}});
+  EXPECT_EQ(resample(array_int, Dim::X, edges, variable::ResampleMode::Mean),
+            resample(array, Dim::X, edges, variable::ResampleMode::Mean));
+}
+
+TEST_F(ResampleTest, max_min) {
+  EXPECT_EQ(resample(array, Dim::X, edges, variable::ResampleMode::Max),
+            DataArray(makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                           units::counts, Values{2, 4, 6, 8}),
+                      {{Dim::X, edges}, {Dim::Y, y}}));
+  EXPECT_EQ(resample(array, Dim::X, edges, variable::ResampleMode::Min),
+            DataArray(makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                           units::counts, Values{1, 3, 5, 7}),
+                      {{Dim::X, edges}, {Dim::Y, y}}));
+}
+
+TEST_F(ResampleTest, max_selects_variance) {
+  EXPECT_EQ(
+      resample(array_with_variances, Dim::X, edges,
+               variable::ResampleMode::Max),
+      DataArray(makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                     units::counts, Values{2, 4, 6, 8},
+                                     Variances{10, 12, 14, 16}),
+                {{Dim::X, edges}, {Dim::Y, y}}));
+}
+
+TEST_F(ResampleTest, masks) {
+  array.masks().set("mask",
+                    makeVariable<bool>(Dims{Dim::X}, Shape{4},
+                                       Values{false, false, true, false}));
+  const auto result =
+      resample(array, Dim::X, edges, variable::ResampleMode::Mean);
+  EXPECT_EQ(result.masks()["mask"],
+            makeVariable<bool>(Dims{Dim::X}, Shape{2}, Values{false, true}));
+}
+
+TEST_F(ResampleTest, fail_unsorted_edges) {
+  const auto unsorted =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 5, 3});
+  EXPECT_THROW_DISCARD(
+      resample(array, Dim::X, unsorted, variable::ResampleMode::Mean),
+      except::BinEdgeError);
+}
@@ -152,3 +152,61 @@ TEST_F(BinnedDatasetSizeOfTest, size_in_memory_of_sliced_bucketed_variable) {
             size_of(buffer_, SizeofTag::Underlying) +
                 size_of(indices_, SizeofTag::Underlying));
 }
+
+TEST(MemoryUsage, variable) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{},
+                                        Variances{});
+  EXPECT_EQ(var.memory_usage().bytes, 8 * sizeof(double));
+  EXPECT_EQ(var.memory_usage().unused_bytes, 0);
+}
+
+TEST(MemoryUsage, slice_reports_full_buffer) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{4});
+  EXPECT_EQ(var.slice({Dim::X, 1}).memory_usage().bytes, 4 * sizeof(double));
+}
+
+TEST(MemoryUsage, structured) {
+  const auto var = makeVariable<Eigen::Vector3d>(Dims{Dim::X}, Shape{2});
+  EXPECT_EQ(var.memory_usage().bytes, 2 * sizeof(Eigen::Vector3d));
+  EXPECT_EQ(var.elements<Eigen::Vector3d>("x").memory_usage().bytes,
+            2 * sizeof(Eigen::Vector3d));
+}
+
+TEST(MemoryUsage, shared_buffers_counted_once) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{4});
+  const DataArray a(var, {{Dim::X, var}, {Dim::Y, var + var}});
+  EXPECT_EQ(memory_usage(a).bytes, 8 * sizeof(double));
+  Dataset ds({{"a", a}, {"b", a}});
+  EXPECT_EQ(memory_usage(ds).bytes, 8 * sizeof(double));
+}
+
+TEST(MemoryUsage, copies_share_buffers_until_written) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{4});
+  DataArray a(var, {{Dim::X, copy(var)}});
+  EXPECT_EQ(memory_usage(a).bytes, 4 * sizeof(double));
+  a.coords()[Dim::X] += var;
+  EXPECT_EQ(memory_usage(a).bytes, 8 * sizeof(double));
+}
+
+TEST_F(BinnedVariableSizeOfTest, memory_usage) {
+  const auto expected = size_of(indices, SizeofTag::Underlying) +
+                        size_of(buffer, SizeofTag::Underlying);
+  EXPECT_EQ(var.memory_usage().bytes, expected);
+  EXPECT_EQ(var.memory_usage().unused_bytes, 0);
+}
+
+TEST_F(BinnedVariableSizeOfTest, memory_usage_unused) {
+  const auto partial = makeVariable<std::pair<scipp::index, scipp::index>>(
+      dims, Values{std::pair{0, 1}, std::pair{1, 1}, std::pair{1, 2}});
+  const auto binned = make_bins(partial, Dim::X, buffer);
+  EXPECT_EQ(binned.memory_usage().unused_bytes, 2 * sizeof(double));
+}
+
+TEST_F(BinnedDataArraySizeOfTest, memory_usage) {
+  const auto expected = size_of(indices, SizeofTag::Underlying) +
+                        size_of(buffer, SizeofTag::Underlying);
+  EXPECT_EQ(var.memory_usage().bytes, expected);
+  const Variable coord(indices, indices.dims());
+  EXPECT_EQ(memory_usage(DataArray(var, {{Dim::Y, coord}})).bytes,
+            expected + size_of(indices, SizeofTag::Underlying));
+}
@@ -84,6 +84,9 @@ class DataAccessHelper {
     auto &&var = get_data_variable(view);
     const auto &dims = view.dims();
     if (var.is_readonly()) {
+      // numpy may read the buffer after the variable has been copied and
+      // written to, so the buffer must be kept alive if replaced by a copy.
+      var.data_handle()->reference_buffers();
       auto array =
           py::array{get_dtype(), dims.shape(), numpy_strides<T>(var.strides()),
                     Getter::template get<T>(std::as_const(view)).data(),
@@ -93,10 +96,13 @@ class DataAccessHelper {
       // no automatic move because of type mismatch
       return py::object{std::move(array)};
     } else {
-      return py::array{get_dtype(), dims.shape(),
-                       numpy_strides<T>(var.strides()),
-                       Getter::template get<T>(view).data(),
-                       get_data_variable_concept_handle(view)};
+      auto array = py::array{get_dtype(), dims.shape(),
+                             numpy_strides<T>(var.strides()),
+                             Getter::template get<T>(view).data(),
+                             get_data_variable_concept_handle(view)};
+      // numpy may write to the buffer after the variable has been copied.
+      var.data_handle()->pin_buffers();
+      return py::object{std::move(array)};
     }
   }
 
@@ -228,6 +234,10 @@ public:
     return std::visit(
         [&view](const auto &data) {
           const auto &dims = view.dims();
+          // Returned objects reference elements, which may be written to
+          // after the variable has been copied.
+          if constexpr (!std::is_const_v<View>)
+            get_data_variable(view).data_handle()->pin_buffers();
           // We return an individual item in two cases:
           // 1. For 0-D data (consistent with numpy behavior, e.g., when slicing
           // a 1-D array).
@@ -209,6 +209,18 @@ void init_buckets(py::module &m) {
         return dataset::buckets::append(a, b);
       },
       py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "reserve",
+      [](Variable &var, const Variable &capacity) {
+        return dataset::buckets::reserve(var, capacity);
+      },
+      py::call_guard<py::gil_scoped_release>());
+  buckets.def(
+      "reserve",
+      [](DataArray &array, const Variable &capacity) {
+        return dataset::buckets::reserve(array, capacity);
+      },
+      py::call_guard<py::gil_scoped_release>());
   buckets.def("map", dataset::buckets::map,
               py::call_guard<py::gil_scoped_release>());
   buckets.def("scale", dataset::buckets::scale,
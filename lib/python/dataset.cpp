@@ -111,11 +111,32 @@ void bind_data_array(py::class_<T, Ignored...> &c) {
   bind_logical<Variable>(c);
 }
 
+auto resample_mode(const std::string &mode) {
+  if (mode == "sum")
+    return variable::ResampleMode::Sum;
+  if (mode == "mean")
+    return variable::ResampleMode::Mean;
+  if (mode == "max")
+    return variable::ResampleMode::Max;
+  if (mode == "min")
+    return variable::ResampleMode::Min;
+  throw std::invalid_argument(
+      "mode must be one of 'sum', 'mean', 'max', 'min'");
+}
+
 template <class T> void bind_rebin(py::module &m) {
   m.def("rebin",
         py::overload_cast<const T &, const Dim, const Variable &>(&rebin),
         py::arg("x"), py::arg("dim"), py::arg("bins"),
         py::call_guard<py::gil_scoped_release>());
+  m.def(
+      "resample",
+      [](const T &x, const Dim dim, const Variable &bins,
+         const std::string &mode) {
+        return resample(x, dim, bins, resample_mode(mode));
+      },
+      py::arg("x"), py::arg("dim"), py::arg("bins"), py::arg("mode") = "sum",
+      py::call_guard<py::gil_scoped_release>());
 }
 
 void init_dataset(py::module &m) {
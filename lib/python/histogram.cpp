@@ -30,7 +30,53 @@ template <class T> void bind_histogram(py::module &m) {
       doc.c_str());
 }
 
+void bind_histogram_multi_dim(py::module &m) {
+  auto doc = Docstring()
+                 .description("Histograms a table of events along the "
+                              "dimensions of all supplied bin edges at once.")
+                 .returns("Histogrammed data with units of counts.")
+                 .rtype<DataArray>()
+                 .param("x", "Table of events to be histogrammed.", "DataArray")
+                 .param("bins", "Bin edges, one per dimension.",
+                        "list[Variable]");
+  m.def(
+      "histogram",
+      [](const DataArray &x, const std::vector<Variable> &bins) {
+        return histogram(x, bins);
+      },
+      py::arg("x"), py::arg("bins"), py::call_guard<py::gil_scoped_release>(),
+      doc.c_str());
+}
+
+void bind_histogram_accumulator(py::module &m) {
+  py::class_<HistogramAccumulator>(m, "HistogramAccumulator", R"(
+    Accumulator of histograms of event chunks, e.g., for live data reduction.
+
+    Chunks may be added concurrently from multiple threads. Snapshots can be
+    taken at any time without stopping ingestion.)")
+      .def(py::init<const Variable &>(), py::arg("bins"),
+           R"(Create an accumulator histogramming into the given bin edges.)")
+      .def("add", &HistogramAccumulator::add, py::arg("chunk"),
+           py::call_guard<py::gil_scoped_release>(),
+           R"(Histogram a chunk of events, given as table or binned data, and
+add the result to the accumulated histogram.)")
+      .def("snapshot", &HistogramAccumulator::snapshot,
+           py::call_guard<py::gil_scoped_release>(),
+           R"(Return a copy of the histogram of all chunks added so far.)")
+      .def("reset", &HistogramAccumulator::reset,
+           py::call_guard<py::gil_scoped_release>(),
+           R"(Discard the accumulated histogram.)")
+      .def_property_readonly(
+          "bins",
+          [](const HistogramAccumulator &self) { return copy(self.edges()); },
+          R"(Bin edges of the histogram.)")
+      .def_property_readonly("chunks", &HistogramAccumulator::chunks,
+                             R"(Number of chunks added since the last reset.)");
+}
+
 void init_histogram(py::module &m) {
   bind_histogram<DataArray>(m);
   bind_histogram<Dataset>(m);
+  bind_histogram_multi_dim(m);
+  bind_histogram_accumulator(m);
 }
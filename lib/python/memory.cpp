@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+#include "scipp/core/memory_usage.h"
+#include "scipp/core/string.h"
+#include "scipp/dataset/dataset.h"
+
+#include "pybind11.h"
+
+using namespace scipp;
+
+namespace py = pybind11;
+
+namespace {
+py::dict to_dict(const core::MemoryUsage &usage) {
+  py::dict out;
+  out["bytes"] = usage.bytes;
+  out["unused_bytes"] = usage.unused_bytes;
+  return out;
+}
+
+template <class T> void bind_memory_usage(py::module &m) {
+  m.def(
+      "memory_usage",
+      [](const T &obj) {
+        if constexpr (std::is_same_v<T, Variable>)
+          return to_dict(obj.memory_usage());
+        else
+          return to_dict(dataset::memory_usage(obj));
+      },
+      py::arg("x"));
+}
+} // namespace
+
+void init_memory(py::module &m) {
+  m.def("memory_stats", []() {
+    const auto stats = core::memory_stats();
+    py::dict by_dtype;
+    for (const auto &[dtype, bytes] : core::memory_by_dtype())
+      by_dtype[py::str(core::to_string(dtype))] = bytes;
+    py::dict out;
+    out["current_bytes"] = stats.current_bytes;
+    out["peak_bytes"] = stats.peak_bytes;
+    out["allocations"] = stats.allocations;
+    out["by_dtype"] = by_dtype;
+    return out;
+  });
+  m.def("reset_peak_memory", &core::reset_peak_memory);
+  bind_memory_usage<Variable>(m);
+  bind_memory_usage<DataArray>(m);
+  bind_memory_usage<Dataset>(m);
+}
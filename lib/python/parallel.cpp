@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+#include "scipp/core/parallel.h"
+
+#include "pybind11.h"
+
+using namespace scipp;
+
+namespace py = pybind11;
+
+void init_parallel(py::module &m) {
+  m.def("get_num_threads", &core::parallel::max_threads);
+  m.def(
+      "set_num_threads",
+      [](const scipp::index n) { core::parallel::set_max_threads(n); },
+      py::arg("n"));
+  m.def("reset_num_threads", &core::parallel::reset_max_threads);
+  m.def("num_threads_is_default", &core::parallel::max_threads_is_default);
+}
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file
+#include "scipp/core/profiler.h"
+
+#include "pybind11.h"
+
+using namespace scipp;
+
+namespace py = pybind11;
+
+void init_profiler(py::module &m) {
+  m.def("set_profiling_enabled", &core::profiler::set_enabled,
+        py::arg("enabled"));
+  m.def("profiling_enabled", &core::profiler::enabled);
+  m.def("reset_profiling", &core::profiler::reset);
+  m.def("profiling_stats", []() {
+    py::list out;
+    for (const auto &op : core::profiler::stats()) {
+      py::dict item;
+      item["name"] = op.name;
+      item["calls"] = op.calls;
+      item["seconds"] = op.seconds;
+      item["elements"] = op.elements;
+      item["bytes_read"] = op.bytes_read;
+      item["bytes_written"] = op.bytes_written;
+      item["max_threads"] = op.max_threads;
+      item["vectorized_chunks"] = op.vectorized_chunks;
+      item["specialized_chunks"] = op.specialized_chunks;
+      item["generic_chunks"] = op.generic_chunks;
+      out.append(item);
+    }
+    return out;
+  });
+  m.def("profiling_summary", &core::profiler::summary);
+  m.def("profiling_chrome_trace", &core::profiler::chrome_trace);
+}
@@ -19,7 +19,10 @@ void init_exceptions(py::module &);
 void init_groupby(py::module &);
 void init_geometry(py::module &);
 void init_histogram(py::module &);
+void init_memory(py::module &);
 void init_operations(py::module &);
+void init_parallel(py::module &);
+void init_profiler(py::module &);
 void init_shape(py::module &);
 void init_reduction(py::module &);
 void init_trigonometry(py::module &);
@@ -51,9 +54,12 @@ void init_core(py::module &m) {
   init_groupby(core);
   init_comparison(core);
   init_operations(core);
+  init_parallel(core);
+  init_profiler(core);
   init_shape(core);
   init_geometry(core);
   init_histogram(core);
+  init_memory(core);
   init_reduction(core);
   init_trigonometry(core);
   init_unary(core);
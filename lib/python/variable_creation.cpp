@@ -67,4 +67,22 @@ void init_creation(py::module &m) {
       },
       py::arg("dims"), py::arg("shape"), py::arg("unit") = units::one,
       py::arg("dtype") = py::none(), py::arg("with_variances") = std::nullopt);
+  m.def(
+      "map_file",
+      [](const std::string &filename, const std::vector<Dim> &dims,
+         const std::vector<scipp::index> &shape, const units::Unit &unit,
+         const py::object &dtype, const scipp::index offset,
+         const std::optional<scipp::index> &variances_offset,
+         const bool copy_on_write) {
+        const auto dtype_ = scipp_dtype(dtype);
+        py::gil_scoped_release release;
+        return variable::map_file(filename, Dimensions(dims, shape), unit,
+                                  dtype_, offset, variances_offset,
+                                  copy_on_write ? core::MapMode::CopyOnWrite
+                                                : core::MapMode::ReadOnly);
+      },
+      py::arg("filename"), py::arg("dims"), py::arg("shape"),
+      py::arg("unit") = units::one, py::arg("dtype") = py::none(),
+      py::arg("offset") = 0, py::arg("variances_offset") = std::nullopt,
+      py::arg("copy_on_write") = false);
 }
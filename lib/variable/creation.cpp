@@ -3,8 +3,10 @@
 /// @file
 /// @author Simon Heybrock
 #include "scipp/core/element/creation.h"
+#include "scipp/core/tag_util.h"
 #include "scipp/core/time_point.h"
 #include "scipp/variable/creation.h"
+#include "scipp/variable/element_array_model.h"
 #include "scipp/variable/shape.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/variable_factory.h"
@@ -67,4 +69,37 @@ Variable zero_like(const Variable &prototype) {
   return {prototype, Dimensions{}};
 }
 
+namespace {
+template <class T> struct MakeMapped {
+  static Variable
+  apply(const std::shared_ptr<const core::MappedFile> &file,
+        const Dimensions &dims, const units::Unit &unit,
+        const scipp::index offset,
+        const std::optional<scipp::index> &variances_offset) {
+    const auto volume = dims.volume();
+    std::optional<element_array<T>> variances;
+    if (variances_offset) {
+      core::expect::canHaveVariances<T>();
+      variances.emplace(file, *variances_offset, volume);
+    }
+    element_array<T> values(file, offset, volume);
+    return Variable(dims, std::make_shared<ElementArrayModel<T>>(
+                              volume, unit, std::move(values),
+                              std::move(variances)));
+  }
+};
+} // namespace
+
+Variable map_file(const std::string &path, const Dimensions &dims,
+                  const units::Unit &unit, const DType type,
+                  const scipp::index offset,
+                  const std::optional<scipp::index> &variances_offset,
+                  const core::MapMode mode) {
+  const auto file = std::make_shared<const core::MappedFile>(path, mode);
+  auto var =
+      core::CallDType<double, float, int64_t, int32_t, bool>::apply<MakeMapped>(
+          type, file, dims, unit, offset, variances_offset);
+  return mode == core::MapMode::ReadOnly ? var.as_const() : var;
+}
+
 } // namespace scipp::variable
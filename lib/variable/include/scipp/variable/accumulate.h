@@ -4,12 +4,75 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <numeric>
+#include <vector>
+
 #include "scipp/variable/shape.h"
 #include "scipp/variable/transform.h"
 
 namespace scipp::variable {
 
 namespace detail {
+/// Add the estimated number of bytes of each slice of `var` along `dim`.
+///
+/// Slices of binned data include their events. The element size is not known
+/// here, 8 bytes are assumed.
+inline void add_slice_bytes(std::vector<scipp::index> &bytes, const Dim dim,
+                            const Variable &var) {
+  const auto size = scipp::size(bytes);
+  const bool sliced = var.dims().contains(dim);
+  const auto element = scipp::index{sizeof(double)};
+  const auto dense = var.dims().volume() / (sliced ? size : 1) * element *
+                     (var.hasVariances() ? 2 : 1);
+  for (auto &b : bytes)
+    b += dense;
+  if (!is_bins(var))
+    return;
+  std::vector<Dim> labels{dim};
+  for (const auto &label : var.dims().labels())
+    if (label != dim)
+      labels.push_back(label);
+  const auto indices =
+      sliced ? transpose(var.bin_indices(), labels) : var.bin_indices();
+  const auto per_slice = sliced ? indices.dims().volume() / size : 0;
+  scipp::index i = 0;
+  scipp::index count = 0;
+  for (const auto &[begin, end] : indices.values<scipp::index_pair>()) {
+    if (sliced) {
+      bytes[i] += (end - begin) * element;
+      if (++count == per_slice) {
+        ++i;
+        count = 0;
+      }
+    } else {
+      for (auto &b : bytes)
+        b += (end - begin) * element;
+    }
+  }
+}
+
+/// Return the cumulative estimated number of bytes of `size` slices of `vars`
+/// along `dim`. The first element is 0, the last element is the total.
+template <class... Vars>
+std::vector<scipp::index> cumulative_slice_bytes(const Dim dim,
+                                                 const scipp::index size,
+                                                 const Vars &... vars) {
+  std::vector<scipp::index> bytes(size);
+  if (size > 0)
+    (add_slice_bytes(bytes, dim, vars), ...);
+  std::vector<scipp::index> cumulative(size + 1, 0);
+  std::partial_sum(bytes.begin(), bytes.end(), cumulative.begin() + 1);
+  return cumulative;
+}
+
+/// Estimated cost of processing one of `size` slices of `vars` along `dim`.
+template <class... Vars>
+core::parallel::ElementCost slice_cost(const Dim dim, const scipp::index size,
+                                       const Vars &... vars) {
+  return {cumulative_slice_bytes(dim, size, vars...).back() /
+          std::max(size, scipp::index{1})};
+}
+
 template <class... Ts, class Op, class Var, class... Other>
 static void do_accumulate(const std::tuple<Ts...> &types, Op op,
                           const std::string_view &name, Var &&var,
@@ -25,7 +88,9 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
       (sizeof...(other) != 1 && var.dims().ndim() == 0))
     return in_place<false>::transform_data(types, op, name, var, other...);
 
+  auto *const scope = core::profiler::current();
   const auto reduce_chunk = [&](auto &&out, const Slice slice) {
+    const core::profiler::Attach attach(scope);
     // A typical cache line has 64 Byte, which would fit, e.g., 8 doubles. If
     // multiple threads write to different elements in the same cache lines we
     // have "false sharing", with a severe negative performance impact. 128 is a
@@ -52,8 +117,27 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
       reduce_chunk(var.slice(slice), slice);
     };
     const auto size = var.dims()[dim];
-    core::parallel::parallel_for(core::parallel::blocked_range(0, size),
-                                 reduce);
+    if (!is_bins(var) && (!is_bins(other) && ...)) {
+      core::parallel::parallel_for(
+          core::parallel::blocked_range(0, size,
+                                        slice_cost(dim, size, var, other...)),
+          reduce);
+      return;
+    }
+    // Bin sizes can vary by orders of magnitude, balance the number of events.
+    const auto cumulative = cumulative_slice_bytes(dim, size, var, other...);
+    const auto bounds = core::parallel::weighted_partition(
+        cumulative,
+        core::parallel::task_count(cumulative.back(), {1},
+                                   core::parallel::max_threads()),
+        false);
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, scipp::size(bounds) - 1, 1),
+        [&](const auto &range) {
+          for (scipp::index i = range.begin(); i < range.end(); ++i)
+            reduce(core::parallel::blocked_range(bounds[i].first,
+                                                 bounds[i + 1].first));
+        });
   };
   if constexpr (sizeof...(other) == 1) {
     const bool reduce_outer =
@@ -71,8 +155,10 @@ static void do_accumulate(const std::tuple<Ts...> &types, Op op,
       // speedup in many cases.
       const auto outer_dim = (*other.dims().begin(), ...);
       const auto outer_size = (other.dims()[outer_dim], ...);
-      const auto nchunk = std::min(scipp::index(24), outer_size);
-      const auto chunk_size = (outer_size + nchunk - 1) / nchunk;
+      const auto chunk_size = core::parallel::grain_size(
+          outer_size, slice_cost(outer_dim, outer_size, other...),
+          core::parallel::max_threads());
+      const auto nchunk = (outer_size + chunk_size - 1) / chunk_size;
       // The threading approach in used here is possible only under the
       // assumption that op(var, broadcast(var, ...)) leaves var unchanged. This
       // is true for "idempotent" *operations* such as `min` and `max` as well
@@ -111,6 +197,8 @@ template <class... Ts, class Op, class Var, class... Other>
 static void accumulate(const std::tuple<Ts...> &types, Op op,
                        const std::string_view name, Var &&var,
                        Other &&... other) {
+  const core::profiler::Scope scope(name);
+  const TransientWriteScope write_scope;
   // `other` not const, threading for cumulative ops not possible
   if constexpr ((!std::is_const_v<std::remove_reference_t<Other>> || ...))
     return in_place<false>::transform_data(types, op, name, var, other...);
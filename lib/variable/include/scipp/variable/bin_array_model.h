@@ -99,6 +99,9 @@ public:
     return sizeof(scipp::index_pair);
   }
 
+  [[nodiscard]] core::MemoryUsage
+  memory_usage(BufferSet &seen) const override;
+
   void setVariances(const Variable &) override {
     except::throw_cannot_have_variances(core::dtype<core::bin<T>>);
   }
@@ -224,6 +224,39 @@ template <class T> void BinArrayModel<T>::assign(const VariableConcept &other) {
   *this = requireT<const BinArrayModel<T>>(other);
 }
 
+namespace bin_array_variable_detail {
+template <class T>
+core::MemoryUsage buffer_memory_usage(const T &buffer, BufferSet &seen) {
+  return memory_usage(buffer, seen);
+}
+} // namespace bin_array_variable_detail
+
+/// Return memory of indices and buffer. Buffer elements outside all bins,
+/// e.g., after slicing or filtering, are reported as unused. The unused
+/// fraction of the buffer is computed from the number of elements.
+template <class T>
+core::MemoryUsage BinArrayModel<T>::memory_usage(BufferSet &seen) const {
+  if (!seen.insert(this).second)
+    return {};
+  auto usage = this->indices()->memory_usage(seen);
+  const auto buffer =
+      bin_array_variable_detail::buffer_memory_usage(m_buffer, seen);
+  usage += buffer;
+  if (const auto size = m_buffer.dims()[this->bin_dim()]; size > 0) {
+    scipp::index used = 0;
+    for (const auto &[begin, end] :
+         requireT<const StructureArrayModel<scipp::index_pair, scipp::index>>(
+             *this->indices())
+             .values())
+      used += end - begin;
+    used = std::min(used, size);
+    usage.unused_bytes += static_cast<scipp::index>(
+        static_cast<double>(buffer.bytes) * static_cast<double>(size - used) /
+        static_cast<double>(size));
+  }
+  return usage;
+}
+
 template <class T>
 ElementArrayView<const scipp::index_pair>
 BinArrayModel<T>::index_values(const core::ElementArrayViewParams &base) const {
@@ -4,8 +4,10 @@
 /// @author Simon Heybrock
 #pragma once
 #include <optional>
+#include <string>
 
 #include "scipp/core/flags.h"
+#include "scipp/core/mapped_file.h"
 
 #include "scipp-variable_export.h"
 #include "scipp/variable/variable.h"
@@ -31,4 +33,19 @@ special_like(const Variable &prototype, const FillValue &fill);
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
 zero_like(const Variable &prototype);
 
+/// Create a variable with elements stored in a memory-mapped file.
+///
+/// Values (and variances if `variances_offset` is given) are read from the
+/// file in native byte order at the given byte offsets, in row-major order of
+/// `dims`. Elements are loaded lazily when accessed, so slicing such a
+/// variable only reads the selected parts of the file. If `mode` is
+/// MapMode::ReadOnly the returned variable is read-only, with
+/// MapMode::CopyOnWrite it can be modified without affecting the file.
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+map_file(const std::string &path, const Dimensions &dims,
+         const units::Unit &unit, const DType type,
+         const scipp::index offset = 0,
+         const std::optional<scipp::index> &variances_offset = std::nullopt,
+         const core::MapMode mode = core::MapMode::ReadOnly);
+
 } // namespace scipp::variable
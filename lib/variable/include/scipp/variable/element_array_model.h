@@ -11,6 +11,9 @@
 #include "scipp/variable/except.h"
 #include "scipp/variable/transform.h"
 #include "scipp/variable/variable_concept.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <optional>
 
 namespace scipp::variable {
@@ -30,7 +33,61 @@ bool equals_impl(const T1 &view1, const T2 &view2) {
     return std::equal(view1.begin(), view1.end(), view2.begin(), view2.end());
 }
 
+namespace detail {
+/// Array of elements held by one or more ElementArrayModel.
+///
+/// Copies of a model share its arrays until one of them is written to.
+template <class T> struct SharedArray {
+  explicit SharedArray(element_array<T> &&array_) : array(std::move(array_)) {
+    record.set(std::max(scipp::index{0}, array.size()) *
+               scipp::index{sizeof(T)});
+  }
+  element_array<T> array;
+  core::DTypeMemoryRecord record{scipp::dtype<T>};
+  /// Set if elements may be referenced outside of the model, e.g., by a numpy
+  /// array or by a view for writing obtained outside of an operation. Such
+  /// arrays are never shared.
+  std::atomic<bool> pinned{false};
+  /// Set if elements are referenced read-only outside of the model, e.g., by
+  /// a read-only numpy array. Such arrays may be shared.
+  std::atomic<bool> referenced{false};
+  /// Pinned or referenced array this array was copied from, kept alive for the
+  /// references to it.
+  std::shared_ptr<const void> previous;
+  /// Edge properties of the elements, reset whenever write access is handed
+  /// out. Not used for pinned arrays, which may be written without notice.
+  /// Since write access outside of a `TransientWriteScope` pins the array, a
+  /// view for writing obtained before the properties were cached can never
+  /// leave them stale.
+  struct EdgeCache {
+    Dimensions dims;
+    Dim dim;
+    EdgeProperties properties;
+  };
+  std::optional<EdgeCache> edge_cache;
+  std::mutex edge_cache_mutex;
+};
+
+/// Mutex that is not copied along with the object containing it.
+struct CopyableMutex {
+  CopyableMutex() = default;
+  CopyableMutex(const CopyableMutex &) noexcept {}
+  CopyableMutex &operator=(const CopyableMutex &) noexcept { return *this; }
+  std::mutex mutex;
+};
+} // namespace detail
+
 /// Implementation of VariableConcept that holds an array with element type T.
+///
+/// Arrays are copy-on-write: `clone` shares the arrays with the new model and
+/// any write access through the non-const `values` or `variances` makes a
+/// private copy first if the array is shared. Write access outside of a
+/// `detail::TransientWriteScope` pins the array, since the returned view may be
+/// written to after the model was cloned or edge properties were cached.
+///
+/// Arrays that element_array stores inline, such as the value of a 0-D
+/// variable, are held by the model itself and copied by `clone`, since copying
+/// them is cheaper than allocating a shared array.
 template <class T> class ElementArrayModel : public VariableConcept {
 public:
   using value_type = T;
@@ -41,7 +98,10 @@ public:
 
   static DType static_dtype() noexcept { return scipp::dtype<T>; }
   DType dtype() const noexcept override { return scipp::dtype<T>; }
-  scipp::index size() const override { return m_values.size(); }
+  scipp::index size() const override {
+    return m_local_values ? m_local_values.size()
+                          : load(m_values)->array.size();
+  }
 
   VariableConceptHandle
   makeDefaultFromParent(const scipp::index size) const override;
@@ -59,24 +119,33 @@ public:
   void setVariances(const Variable &variances) override;
 
   VariableConceptHandle clone() const override;
+  VariableConceptHandle copy_on_write() const override;
+  void pin_buffers() override;
+  void reference_buffers() override;
+  bool can_cache_edge_properties() const override;
+  std::optional<EdgeProperties>
+  cached_edge_properties(const Dimensions &dims, const Dim dim) const override;
+  void cache_edge_properties(const Dimensions &dims, const Dim dim,
+                             const EdgeProperties &properties) const override;
 
   bool hasVariances() const noexcept override {
-    return m_variances.has_value();
+    return m_local_variances || m_variances != nullptr;
   }
 
   auto values(const core::ElementArrayViewParams &base) const {
-    return ElementArrayView(base, m_values.data());
+    return ElementArrayView(base, data(m_local_values, m_values));
   }
   auto values(const core::ElementArrayViewParams &base) {
-    return ElementArrayView(base, m_values.data());
+    return ElementArrayView(base, writable(m_local_values, m_values).data());
   }
   auto variances(const core::ElementArrayViewParams &base) const {
     expectHasVariances();
-    return ElementArrayView(base, m_variances->data());
+    return ElementArrayView(base, data(m_local_variances, m_variances));
   }
   auto variances(const core::ElementArrayViewParams &base) {
     expectHasVariances();
-    return ElementArrayView(base, m_variances->data());
+    return ElementArrayView(base,
+                            writable(m_local_variances, m_variances).data());
   }
 
   scipp::index dtype_size() const override { return sizeof(T); }
@@ -84,21 +153,56 @@ public:
     throw except::TypeError("This data type does not have bin indices.");
   }
 
+  core::MemoryUsage memory_usage(BufferSet &seen) const override {
+    // Arrays shared with copies of this model are counted only once.
+    core::MemoryUsage usage;
+    for (const auto *local : {&m_local_values, &m_local_variances})
+      if (*local && seen.insert(local).second)
+        usage.bytes += local->size() * scipp::index{sizeof(T)};
+    for (const auto &buffer : {load(m_values), load(m_variances)})
+      if (buffer && seen.insert(buffer.get()).second)
+        usage.bytes += buffer->array.size() * scipp::index{sizeof(T)};
+    return usage;
+  }
+
   std::span<const T> values() const {
-    return {m_values.data(), m_values.data() + m_values.size()};
+    const auto *begin = data(m_local_values, m_values);
+    return {begin, begin + size()};
   }
 
   std::span<T> values() {
-    return {m_values.data(), m_values.data() + m_values.size()};
+    auto &array = writable(m_local_values, m_values);
+    return {array.data(), array.data() + array.size()};
   }
 
 private:
+  using buffer_type = std::shared_ptr<detail::SharedArray<T>>;
   void expectHasVariances() const {
     if (!hasVariances())
       throw except::VariancesError("Variable does not have variances.");
   }
-  element_array<T> m_values;
-  std::optional<element_array<T>> m_variances;
+  static buffer_type make_buffer(element_array<T> &&array) {
+    return std::make_shared<detail::SharedArray<T>>(std::move(array));
+  }
+  static void store(element_array<T> &local, buffer_type &buffer,
+                    element_array<T> &&array);
+  static buffer_type share(const buffer_type &buffer);
+  buffer_type load(const buffer_type &buffer) const;
+  const T *data(const element_array<T> &local,
+                const buffer_type &buffer) const {
+    return local ? local.data() : load(buffer)->array.data();
+  }
+  void detach(buffer_type &buffer, std::unique_lock<std::mutex> &lock,
+              bool read_only_mapping);
+  element_array<T> &writable(element_array<T> &local, buffer_type &buffer);
+  /// Arrays held by the model itself, valid instead of `m_values` and
+  /// `m_variances` for arrays stored inline by element_array.
+  element_array<T> m_local_values;
+  element_array<T> m_local_variances;
+  buffer_type m_values;
+  buffer_type m_variances;
+  /// Guards replacing `m_values` and `m_variances` when detaching.
+  mutable detail::CopyableMutex m_detach_mutex;
 };
 
 namespace {
@@ -69,21 +69,172 @@ template <class T>
 ElementArrayModel<T>::ElementArrayModel(
     const scipp::index size, const units::Unit &unit, element_array<T> model,
     std::optional<element_array<T>> variances)
-    : VariableConcept(unit),
-      m_values(model ? std::move(model)
-                     : element_array<T>(size, default_init<T>::value())),
-      m_variances(std::move(variances)) {
-  if (m_variances)
+    : VariableConcept(unit) {
+  if (variances)
     core::expect::canHaveVariances<T>();
-  if (size != scipp::size(m_values))
+  if (model && size != model.size())
     throw except::DimensionError("Creating Variable: data size does not match "
                                  "volume given by dimension extents.");
-  if (m_variances && !*m_variances)
-    *m_variances = element_array<T>(size, default_init<T>::value());
+  store(m_local_values, m_values,
+        model ? std::move(model)
+              : element_array<T>(size, default_init<T>::value()));
+  if (variances)
+    store(m_local_variances, m_variances,
+          *variances ? std::move(*variances)
+                     : element_array<T>(size, default_init<T>::value()));
+}
+
+/// Store `array` in `local` if element_array holds its elements inline, else in
+/// a new shared array in `buffer`.
+template <class T>
+void ElementArrayModel<T>::store(element_array<T> &local, buffer_type &buffer,
+                                 element_array<T> &&array) {
+  if (array.size() <= element_array<T>::inline_capacity && !array.mapping()) {
+    local = std::move(array);
+    buffer.reset();
+  } else {
+    local = element_array<T>();
+    buffer = make_buffer(std::move(array));
+  }
+}
+
+/// Return `buffer` if it may be shared by another model, else a copy.
+template <class T>
+typename ElementArrayModel<T>::buffer_type
+ElementArrayModel<T>::share(const buffer_type &buffer) {
+  if (!buffer || !buffer->pinned)
+    return buffer;
+  return make_buffer(element_array<T>(buffer->array));
+}
+
+/// Return a reference to `buffer`, which may be replaced concurrently.
+template <class T>
+typename ElementArrayModel<T>::buffer_type
+ElementArrayModel<T>::load(const buffer_type &buffer) const {
+  const std::lock_guard lock(m_detach_mutex.mutex);
+  return buffer;
+}
+
+/// Replace `buffer` by a copy if it is shared with another model, or if it
+/// refers to a read-only memory-mapped file and `read_only_mapping` is true.
+/// `lock` must hold `m_detach_mutex`.
+template <class T>
+void ElementArrayModel<T>::detach(buffer_type &buffer,
+                                  std::unique_lock<std::mutex> &lock,
+                                  const bool read_only_mapping) {
+  const auto &mapping = buffer->array.mapping();
+  if (buffer.use_count() == 1 &&
+      !(read_only_mapping && mapping &&
+        mapping->mode() == core::MapMode::ReadOnly))
+    return;
+  const auto shared = buffer;
+  // Not holding the lock while copying, which may run tasks of other threads.
+  lock.unlock();
+  auto copied = make_buffer(element_array<T>(shared->array));
+  // Pinned or referenced arrays may be referenced by numpy arrays, which must
+  // remain valid.
+  if (shared->pinned || shared->referenced)
+    copied->previous = shared;
+  lock.lock();
+  if (buffer == shared)
+    buffer = std::move(copied);
+}
+
+/// Return array of `buffer` for writing, copying it first if it is shared with
+/// another model or refers to a read-only memory-mapped file.
+///
+/// The array is pinned unless the write access is transient, see
+/// `detail::TransientWriteScope`. Arrays held by the model itself are never
+/// shared and are returned as is.
+template <class T>
+element_array<T> &ElementArrayModel<T>::writable(element_array<T> &local,
+                                                 buffer_type &buffer) {
+  if (local)
+    return local;
+  std::unique_lock lock(m_detach_mutex.mutex);
+  detach(buffer, lock, true);
+  if (!detail::TransientWriteScope::active())
+    buffer->pinned = true;
+  const std::lock_guard cache_lock(buffer->edge_cache_mutex);
+  buffer->edge_cache.reset();
+  return buffer->array;
 }
 
 template <class T> VariableConceptHandle ElementArrayModel<T>::clone() const {
-  return std::make_shared<ElementArrayModel<T>>(*this);
+  auto out = std::make_shared<ElementArrayModel<T>>(*this);
+  out->m_values = share(load(m_values));
+  out->m_variances = share(load(m_variances));
+  return out;
+}
+
+/// Return a clone sharing the arrays of this model, provided that copying
+/// elements is equivalent to a deep copy.
+///
+/// Elements such as Variable or DataArray are handles, so cloning their array
+/// would not copy the referenced data.
+template <class T>
+VariableConceptHandle ElementArrayModel<T>::copy_on_write() const {
+  if constexpr (std::is_trivially_copyable_v<T> ||
+                std::is_same_v<T, std::string>)
+    return clone();
+  else
+    return nullptr;
+}
+
+/// Pin the arrays of this model, see `VariableConcept::pin_buffers`.
+///
+/// Read-only memory-mapped arrays are not copied, they are replaced by a copy
+/// only once written to.
+template <class T> void ElementArrayModel<T>::pin_buffers() {
+  std::unique_lock lock(m_detach_mutex.mutex);
+  for (auto *buffer : {&m_values, &m_variances})
+    if (*buffer) {
+      detach(*buffer, lock, false);
+      (*buffer)->pinned = true;
+    }
+}
+
+/// Mark the arrays of this model as referenced, see
+/// `VariableConcept::reference_buffers`.
+template <class T> void ElementArrayModel<T>::reference_buffers() {
+  for (const auto &buffer : {load(m_values), load(m_variances)})
+    if (buffer)
+      buffer->referenced = true;
+}
+
+template <class T>
+bool ElementArrayModel<T>::can_cache_edge_properties() const {
+  if (m_local_values)
+    return false;
+  const auto buffer = load(m_values);
+  // Mapped files may be modified by other processes.
+  return !buffer->pinned && !buffer->array.mapping();
+}
+
+template <class T>
+std::optional<EdgeProperties>
+ElementArrayModel<T>::cached_edge_properties(const Dimensions &dims,
+                                             const Dim dim) const {
+  if (m_local_values)
+    return std::nullopt;
+  const auto buffer = load(m_values);
+  std::lock_guard lock(buffer->edge_cache_mutex);
+  const auto &cache = buffer->edge_cache;
+  if (buffer->pinned || !cache || cache->dim != dim || !(cache->dims == dims))
+    return std::nullopt;
+  return cache->properties;
+}
+
+template <class T>
+void ElementArrayModel<T>::cache_edge_properties(
+    const Dimensions &dims, const Dim dim,
+    const EdgeProperties &properties) const {
+  if (!can_cache_edge_properties())
+    return;
+  const auto buffer = load(m_values);
+  std::lock_guard lock(buffer->edge_cache_mutex);
+  buffer->edge_cache =
+      typename detail::SharedArray<T>::EdgeCache{dims, dim, properties};
 }
 
 template <class T>
@@ -109,21 +260,31 @@ bool ElementArrayModel<T>::equals(const Variable &a, const Variable &b) const {
 
 template <class T>
 void ElementArrayModel<T>::assign(const VariableConcept &other) {
-  *this = requireT<const ElementArrayModel<T>>(other);
+  const auto &model = requireT<const ElementArrayModel<T>>(other);
+  *this = model;
+  // Copy-assigning an element_array does not preserve an invalid array.
+  m_local_values = element_array<T>(model.m_local_values);
+  m_local_variances = element_array<T>(model.m_local_variances);
+  m_values = share(model.load(model.m_values));
+  m_variances = share(model.load(model.m_variances));
 }
 
 template <class T>
 void ElementArrayModel<T>::setVariances(const Variable &variances) {
   if (!core::canHaveVariances<T>())
     throw except::VariancesError("This data type cannot have variances.");
-  if (!variances.is_valid())
-    return m_variances.reset();
-  // TODO Could move if refcount is 1?
-  if (variances.hasVariances())
-    throw except::VariancesError(
-        "Cannot set variances from variable with variances.");
-  m_variances.emplace(
-      requireT<const ElementArrayModel>(variances.data()).m_values);
+  if (!variances.is_valid()) {
+    m_local_variances = element_array<T>();
+    m_variances.reset();
+  } else {
+    if (variances.hasVariances())
+      throw except::VariancesError(
+          "Cannot set variances from variable with variances.");
+    // Shared until either is written to, so no copy is made here.
+    const auto &model = requireT<const ElementArrayModel>(variances.data());
+    m_local_variances = element_array<T>(model.m_local_values);
+    m_variances = share(model.load(model.m_values));
+  }
 }
 
 #define INSTANTIATE_ELEMENT_ARRAY_VARIABLE_BASE(name, ...)                     \
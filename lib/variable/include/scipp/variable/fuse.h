@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+/// @file Deferred evaluation of chained element-wise operations.
+///
+/// Every arithmetic operation on variables allocates a new output, so an
+/// expression such as `a * b + c * d` creates three full-size temporaries and
+/// makes four passes over memory. The helpers in this file record such an
+/// expression instead of evaluating it, and evaluate it later with a *single*
+/// call to `transform`, i.e., with one output allocation and one pass:
+///
+///   Variable out = fuse(a) * fuse(b) + fuse(c) * fuse(d);
+///
+/// The recorded expression is a tree of element operations from
+/// `core/element/arithmetic.h` and `core/element/math.h`. Since the same
+/// element operations are used, units and variances are propagated exactly as
+/// if the operations were applied one after the other. Supported inputs are
+/// variables with dtype float64 or float32, where all inputs must have the same
+/// dtype.
+///
+/// Note that expressions store references to their input variables. They must
+/// therefore be evaluated before any of the inputs goes out of scope.
+#pragma once
+
+#include <tuple>
+#include <utility>
+
+#include "scipp/core/element/arithmetic.h"
+#include "scipp/core/element/math.h"
+#include "scipp/variable/transform.h"
+#include "scipp/variable/variable.h"
+
+namespace scipp::variable {
+
+namespace fuse_detail {
+
+/// Leaf of an expression tree, referring to an input variable.
+struct Leaf {
+  static constexpr size_t arity = 1;
+  const Variable *var;
+  auto variables() const noexcept { return std::tuple{var}; }
+  template <class T> constexpr auto operator()(const T &x) const { return x; }
+};
+
+/// Node of an expression tree, applying `Op` to the results of its children.
+///
+/// The node is called with the elements (or units) of all leaves of the
+/// subtree. These are split and forwarded to the children based on their
+/// arity.
+template <class Op, class... Children> struct Node {
+  static constexpr size_t arity = (Children::arity + ...);
+  Op op;
+  std::tuple<Children...> children;
+
+  auto variables() const noexcept {
+    return std::apply(
+        [](const auto &... child) {
+          return std::tuple_cat(child.variables()...);
+        },
+        children);
+  }
+
+  template <class... Ts> constexpr auto operator()(const Ts &... args) const {
+    static_assert(sizeof...(Ts) == arity);
+    return call(std::index_sequence_for<Children...>{},
+                std::forward_as_tuple(args...));
+  }
+
+private:
+  template <size_t I> static constexpr size_t offset() noexcept {
+    constexpr std::array arities{Children::arity...};
+    size_t offset = 0;
+    for (size_t i = 0; i < I; ++i)
+      offset += arities[i];
+    return offset;
+  }
+
+  template <size_t I, class Args>
+  constexpr auto call_child(const Args &args) const {
+    using Child = std::tuple_element_t<I, std::tuple<Children...>>;
+    return [&]<size_t... J>(std::index_sequence<J...>) {
+      return std::get<I>(children)(std::get<offset<I>() + J>(args)...);
+    }
+    (std::make_index_sequence<Child::arity>{});
+  }
+
+  template <size_t... I, class Args>
+  constexpr auto call(std::index_sequence<I...>, const Args &args) const {
+    return op(call_child<I>(args)...);
+  }
+};
+
+/// Element types supported for inputs of fused expressions. The same type is
+/// required for all inputs.
+using types = std::tuple<double, float>;
+
+} // namespace fuse_detail
+
+/// Recorded, not yet evaluated, expression of element-wise operations.
+///
+/// Use `fuse` to create an expression from a variable, combine expressions
+/// using arithmetic operators and math functions, and convert to `Variable` to
+/// evaluate.
+template <class Expr> class Fused {
+public:
+  explicit Fused(Expr expr) : m_expr(std::move(expr)) {}
+
+  const Expr &expr() const noexcept { return m_expr; }
+
+  /// Evaluate the expression in a single pass, returning a new variable.
+  [[nodiscard]] Variable eval() const {
+    return std::apply(
+        [this](const auto *... vars) {
+          return detail::transform(fuse_detail::types{}, m_expr, "fuse",
+                                   *vars...);
+        },
+        m_expr.variables());
+  }
+
+  operator Variable() const { return eval(); }
+
+private:
+  Expr m_expr;
+};
+
+/// Start recording a fused expression with `var` as input.
+[[nodiscard]] inline auto fuse(const Variable &var) {
+  return Fused{fuse_detail::Leaf{&var}};
+}
+// Expressions store references, temporaries are not supported.
+void fuse(Variable &&) = delete;
+
+namespace fuse_detail {
+template <class T> decltype(auto) as_expr(const Fused<T> &x) {
+  return x.expr();
+}
+inline auto as_expr(const Variable &var) { return Leaf{&var}; }
+
+template <class T> struct is_fused : std::false_type {};
+template <class T> struct is_fused<Fused<T>> : std::true_type {};
+
+template <class T>
+inline constexpr bool is_operand =
+    is_fused<T>::value || std::is_same_v<T, Variable>;
+
+/// True if at least one of the operands is a fused expression and the other is
+/// a fused expression or a variable.
+template <class A, class B>
+inline constexpr bool is_fused_operands =
+    (is_fused<A>::value || is_fused<B>::value) && is_operand<A> &&
+    is_operand<B>;
+
+template <class Op, class... Args>
+auto make_node(const Op &op, const Args &... args) {
+  return Fused{Node<Op, std::decay_t<decltype(as_expr(args))>...>{
+      op, {as_expr(args)...}}};
+}
+} // namespace fuse_detail
+
+#define SCIPP_FUSED_BINARY(name, op)                                           \
+  template <class A, class B,                                                  \
+            std::enable_if_t<fuse_detail::is_fused_operands<A, B>, int> = 0>   \
+  auto name(const A &a, const B &b) {                                          \
+    return fuse_detail::make_node(core::element::op, a, b);                    \
+  }                                                                            \
+  template <class A,                                                           \
+            std::enable_if_t<fuse_detail::is_fused<A>::value, int> = 0>        \
+  void name(const A &, Variable &&) = delete;                                  \
+  template <class B,                                                           \
+            std::enable_if_t<fuse_detail::is_fused<B>::value, int> = 0>        \
+  void name(Variable &&, const B &) = delete;
+
+SCIPP_FUSED_BINARY(operator+, add)
+SCIPP_FUSED_BINARY(operator-, subtract)
+SCIPP_FUSED_BINARY(operator*, multiply)
+SCIPP_FUSED_BINARY(operator/, divide)
+#undef SCIPP_FUSED_BINARY
+
+#define SCIPP_FUSED_UNARY(name, op)                                            \
+  template <class T> auto name(const Fused<T> &a) {                            \
+    return fuse_detail::make_node(core::element::op, a);                       \
+  }
+
+SCIPP_FUSED_UNARY(operator-, unary_minus)
+SCIPP_FUSED_UNARY(abs, abs)
+SCIPP_FUSED_UNARY(sqrt, sqrt)
+SCIPP_FUSED_UNARY(reciprocal, reciprocal)
+SCIPP_FUSED_UNARY(exp, exp)
+SCIPP_FUSED_UNARY(log, log)
+SCIPP_FUSED_UNARY(log10, log10)
+#undef SCIPP_FUSED_UNARY
+
+} // namespace scipp::variable
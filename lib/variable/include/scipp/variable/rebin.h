@@ -4,6 +4,8 @@
 /// @author Simon Heybrock
 #pragma once
 
+#include <vector>
+
 #include "scipp-variable_export.h"
 #include "scipp/variable/variable.h"
 
@@ -14,4 +16,43 @@ namespace scipp::variable {
                                                    const Variable &oldCoord,
                                                    const Variable &newCoord);
 
+/// Reduction applied by `resample` to the old bins overlapping a new bin.
+enum class ResampleMode { Sum, Mean, Max, Min };
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT Variable
+resample(const Variable &var, const Dim dim, const Variable &oldCoord,
+         const Variable &newCoord, const ResampleMode mode);
+
+/// Rebin of variables with shared 1-D bin edges.
+///
+/// The overlap of old and new bins is computed once and stored as a sparse
+/// matrix, so the rebin can be applied to many variables, or to variables with
+/// many spectra, without walking the edges again. Every new bin overlaps a
+/// contiguous range of old bins, so the matrix stores the first old bin and the
+/// overlap weights for each new bin.
+class SCIPP_VARIABLE_EXPORT Rebinner {
+public:
+  Rebinner(const Dim dim, const Variable &oldCoord, const Variable &newCoord);
+
+  [[nodiscard]] Variable operator()(const Variable &var) const;
+
+  [[nodiscard]] Dim dim() const noexcept { return m_dim; }
+
+  [[nodiscard]] static bool supports(const Variable &var,
+                                     const Variable &oldCoord,
+                                     const Variable &newCoord);
+
+private:
+  template <class Out, class In>
+  void apply(Variable &out, const Variable &in) const;
+
+  Dim m_dim;
+  scipp::index m_old_size;
+  /// Index of the first old bin overlapping each new bin.
+  std::vector<scipp::index> m_first;
+  /// Offsets of the weights of each new bin in `m_weights`.
+  std::vector<scipp::index> m_offsets;
+  std::vector<double> m_weights;
+};
+
 } // namespace scipp::variable
@@ -62,8 +62,13 @@ public:
   }
 
   VariableConceptHandle clone() const override {
-    return std::make_shared<StructureArrayModel<T, Elem>>(*this);
+    auto out = std::make_shared<StructureArrayModel<T, Elem>>(*this);
+    out->m_elements = m_elements->clone();
+    return out;
   }
+  VariableConceptHandle copy_on_write() const override { return clone(); }
+  void pin_buffers() override { m_elements->pin_buffers(); }
+  void reference_buffers() override { m_elements->reference_buffers(); }
 
   auto values(const core::ElementArrayViewParams &base) const {
     return ElementArrayView(base, get_values());
@@ -79,6 +84,12 @@ public:
     throw except::TypeError("This data type does not have bin indices.");
   }
 
+  core::MemoryUsage memory_usage(BufferSet &seen) const override {
+    // Buffer is owned by the elements, which may be shared with other
+    // variables.
+    return m_elements->memory_usage(seen);
+  }
+
   std::span<const T> values() const {
     return {get_values(), static_cast<size_t>(size())};
   }
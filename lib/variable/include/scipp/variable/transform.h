@@ -31,20 +31,26 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <optional>
 #include <string_view>
 
 #include "scipp/common/overloaded.h"
 
+#include "scipp/core/element_array_view.h"
 #include "scipp/core/has_eval.h"
 #include "scipp/core/multi_index.h"
 #include "scipp/core/parallel.h"
+#include "scipp/core/profiler.h"
+#include "scipp/core/simd.h"
 #include "scipp/core/transform_common.h"
 #include "scipp/core/value_and_variance.h"
 #include "scipp/core/values_and_variances.h"
 
 #include "scipp/variable/except.h"
 #include "scipp/variable/variable.h"
+#include "scipp/variable/variable_concept.h"
 #include "scipp/variable/variable_factory.h"
 #include "scipp/variable/visit.h"
 
@@ -79,6 +85,74 @@ template <class T> static constexpr auto array_params(T &&iterable) noexcept {
     return iterable;
 }
 
+/// Bytes per element of an operand, including variances.
+template <class T> constexpr scipp::index element_bytes() noexcept {
+  using U = std::decay_t<T>;
+  return sizeof(typename U::value_type) * (has_variances_v<U> ? 2 : 1);
+}
+
+/// Relative cost of processing an element of an operand. Types that are not
+/// trivially copyable, such as strings, imply indirection and allocations.
+template <class T> constexpr double element_weight() noexcept {
+  using U = std::decay_t<T>;
+  return std::is_trivially_copyable_v<typename U::value_type> ? 1.0 : 8.0;
+}
+
+/// Estimated cost per element for the parallel loop in transform. For binned
+/// data this is the cost per event.
+template <class... Ts> core::parallel::ElementCost element_cost() noexcept {
+  return {(element_bytes<Ts>() + ...), std::max({element_weight<Ts>()...})};
+}
+
+/// Add statistics of a task to the profiler scope, if any. Memory traffic is
+/// estimated from the element sizes of the operands, i.e., broadcast operands
+/// are overestimated.
+template <bool in_place, class Out, class... Args>
+void record_task(core::profiler::Scope *scope,
+                 core::profiler::TaskStats &task) noexcept {
+  if (!scope)
+    return;
+  task.bytes_read =
+      task.elements *
+      (scipp::index{in_place ? element_bytes<Out>() : 0} + ... +
+       element_bytes<Args>());
+  task.bytes_written = task.elements * element_bytes<Out>();
+  scope->add_task(task);
+}
+
+/// Call `run(indices, end)` in parallel for chunks of the binned data indexed
+/// by `begin`.
+///
+/// Bin sizes can vary by orders of magnitude, so work is split based on the
+/// number of events instead of the number of bins. Large bins are split into
+/// multiple chunks if supported by the index.
+template <class Index, class Run>
+void parallel_for_bins(const Index &begin,
+                       const core::parallel::ElementCost &cost,
+                       const Run &run) {
+  const auto cumulative = begin.cumulative_bin_sizes();
+  if (cumulative.back() == 0)
+    return; // all bins are empty
+  const auto bounds = core::parallel::weighted_partition(
+      cumulative,
+      core::parallel::task_count(cumulative.back(), cost,
+                                 core::parallel::max_threads()),
+      begin.can_split_bins());
+  const auto at = [&begin](const auto &bound) {
+    auto index = begin;
+    index.set_index(bound.first, bound.second);
+    return index;
+  };
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, scipp::size(bounds) - 1, 1),
+      [&](const auto &range) {
+        for (scipp::index i = range.begin(); i < range.end(); ++i) {
+          auto indices = at(bounds[i]);
+          run(indices, at(bounds[i + 1]));
+        }
+      });
+}
+
 template <size_t N_Operands, bool in_place>
 inline constexpr auto stride_special_cases =
     std::array<std::array<scipp::index, N_Operands>, 0>{};
@@ -179,14 +253,219 @@ static constexpr void call_in_place(Op &&op, const Indices &indices, Arg &&arg,
     arg.variances.data()[i] = arg_.variance;
   }
 }
+
+/// Number of elements processed per iteration of the vectorized inner loop.
+/// 16 doubles correspond to two AVX-512 registers.
+inline constexpr scipp::index simd_pack_size = 16;
+
+template <class T> struct simd_operand : std::false_type {};
+template <class T>
+struct simd_operand<ElementArrayView<T>>
+    : std::bool_constant<
+          std::is_same_v<std::remove_const_t<T>, double> ||
+          std::is_same_v<std::remove_const_t<T>, float> ||
+          std::is_same_v<std::remove_const_t<T>, int64_t> ||
+          std::is_same_v<std::remove_const_t<T>, int32_t>> {
+  using value_type = std::remove_const_t<T>;
+  static constexpr bool is_const = std::is_const_v<T>;
+  static constexpr bool variances = false;
+};
+template <class T>
+struct simd_operand<ValuesAndVariances<ElementArrayView<T>>>
+    : simd_operand<ElementArrayView<T>> {
+  static constexpr bool variances = true;
+};
+
+/// Return true if the vectorized inner loop can be used.
+///
+/// This requires operands with fundamental element types, a contiguous
+/// output, and read-only inputs. The latter two conditions ensure that the
+/// result does not depend on the order of processing elements, which is not the
+/// case for, e.g., cumulative operations.
+template <class Strides, class... Operands> struct is_simd_eligible;
+template <scipp::index... Strides, class Out, class... Args>
+struct is_simd_eligible<std::integer_sequence<scipp::index, Strides...>, Out,
+                        Args...>
+    : std::bool_constant<
+          std::array{Strides...}[0] == 1 &&
+          ((Strides == 0 || Strides == 1) && ...) &&
+          simd_operand<Out>::value && !simd_operand<Out>::is_const &&
+          ((simd_operand<Args>::value && simd_operand<Args>::is_const) &&
+           ...)> {};
+template <class Strides, class... Operands>
+inline constexpr bool is_simd_eligible_v =
+    is_simd_eligible<Strides, Operands...>::value;
+
+/// Local staging buffer holding a pack of values (and variances) of an operand.
+///
+/// The element op is applied to these buffers instead of directly to the
+/// operand's memory. This avoids potential aliasing between operands and
+/// unifies handling of values and variances, so the compiler can vectorize the
+/// loop over the elements of a pack.
+template <class Operand> struct SimdPack {
+  using traits = simd_operand<Operand>;
+  using T = typename traits::value_type;
+  alignas(64) std::array<T, simd_pack_size> values;
+  alignas(64) std::array<T, traits::variances ? simd_pack_size : 0> variances;
+
+  template <scipp::index Stride>
+  SCIPP_SIMD_INLINE void load(const Operand &operand,
+                              const scipp::index i) noexcept {
+    if constexpr (traits::variances) {
+      load_impl<Stride>(values, operand.values.data() + i);
+      load_impl<Stride>(variances, operand.variances.data() + i);
+    } else {
+      load_impl<Stride>(values, operand.data() + i);
+    }
+  }
+
+  SCIPP_SIMD_INLINE void store(Operand &operand,
+                               const scipp::index i) const noexcept {
+    if constexpr (traits::variances) {
+      std::copy(values.begin(), values.end(), operand.values.data() + i);
+      std::copy(variances.begin(), variances.end(),
+                operand.variances.data() + i);
+    } else {
+      std::copy(values.begin(), values.end(), operand.data() + i);
+    }
+  }
+
+  SCIPP_SIMD_INLINE decltype(auto) get(const scipp::index l) noexcept {
+    if constexpr (traits::variances)
+      return ValueAndVariance{values[l], variances[l]};
+    else
+      return (values[l]);
+  }
+
+  template <class V>
+  SCIPP_SIMD_INLINE void put(const scipp::index l, const V &x) noexcept {
+    if constexpr (traits::variances) {
+      values[l] = x.value;
+      variances[l] = x.variance;
+    }
+  }
+
+private:
+  template <scipp::index Stride, class Ptr>
+  static SCIPP_SIMD_INLINE void
+  load_impl(std::array<T, simd_pack_size> &pack, const Ptr ptr) noexcept {
+    if constexpr (Stride == 0)
+      pack.fill(*ptr);
+    else
+      std::copy(ptr, ptr + simd_pack_size, pack.begin());
+  }
+};
+
+/// Apply `op` to `n_packs` packs of `simd_pack_size` elements.
+///
+/// Operands with stride 0 (broadcast) are loaded only once.
+template <bool in_place, scipp::index... Strides, class Op, class Out,
+          class... Args, size_t... I>
+SCIPP_SIMD_INLINE void
+pack_loop(Op &&op, std::array<scipp::index, sizeof...(Args) + 1> indices,
+          const scipp::index n_packs, std::index_sequence<I...>, Out &&out,
+          Args &&... args) {
+  constexpr std::array strides{Strides...};
+  SimdPack<std::decay_t<Out>> out_pack;
+  std::tuple<SimdPack<std::decay_t<Args>>...> packs;
+  (
+      [&]() {
+        if constexpr (strides[I + 1] == 0)
+          std::get<I>(packs).template load<0>(args, indices[I + 1]);
+      }(),
+      ...);
+  for (scipp::index p = 0; p < n_packs; ++p) {
+    if constexpr (in_place)
+      out_pack.template load<1>(out, indices[0]);
+    (
+        [&]() {
+          if constexpr (strides[I + 1] != 0)
+            std::get<I>(packs).template load<1>(args, indices[I + 1]);
+        }(),
+        ...);
+    for (scipp::index l = 0; l < simd_pack_size; ++l) {
+      auto &&out_ = out_pack.get(l);
+      if constexpr (in_place)
+        op(out_, std::get<I>(packs).get(l)...);
+      else
+        out_ = op(std::get<I>(packs).get(l)...);
+      out_pack.put(l, out_);
+    }
+    out_pack.store(out, indices[0]);
+    ((indices[I + 1] += strides[I + 1] * simd_pack_size), ...);
+    indices[0] += simd_pack_size;
+  }
+}
+
+template <bool in_place, scipp::index... Strides, class... Ts>
+static void pack_loop_default(Ts &&... args) {
+  pack_loop<in_place, Strides...>(std::forward<Ts>(args)...);
+}
+
+#ifdef SCIPP_SIMD_DISPATCH
+template <bool in_place, scipp::index... Strides, class... Ts>
+SCIPP_SIMD_TARGET_AVX2 static void pack_loop_avx2(Ts &&... args) {
+  pack_loop<in_place, Strides...>(std::forward<Ts>(args)...);
+}
+
+template <bool in_place, scipp::index... Strides, class... Ts>
+SCIPP_SIMD_TARGET_AVX512 static void pack_loop_avx512(Ts &&... args) {
+  pack_loop<in_place, Strides...>(std::forward<Ts>(args)...);
+}
+#endif
+
+/// Process as many elements as possible using the vectorized pack loop and
+/// return the number of processed elements.
+template <bool in_place, scipp::index... Strides, class Op, class Out,
+          class... Args>
+static scipp::index vectorized_inner_loop(
+    Op &&op, const std::array<scipp::index, sizeof...(Args) + 1> &indices,
+    const scipp::index n, Out &&out, Args &&... args) {
+  const auto n_packs = n / simd_pack_size;
+  if (n_packs == 0)
+    return 0;
+  const auto seq = std::make_index_sequence<sizeof...(Args)>{};
+#ifdef SCIPP_SIMD_DISPATCH
+  switch (core::simd::level()) {
+  case core::simd::Level::AVX512:
+    pack_loop_avx512<in_place, Strides...>(op, indices, n_packs, seq, out,
+                                           args...);
+    break;
+  case core::simd::Level::AVX2:
+    pack_loop_avx2<in_place, Strides...>(op, indices, n_packs, seq, out,
+                                         args...);
+    break;
+  default:
+    pack_loop_default<in_place, Strides...>(op, indices, n_packs, seq, out,
+                                            args...);
+  }
+#else
+  pack_loop_default<in_place, Strides...>(op, indices, n_packs, seq, out,
+                                          args...);
+#endif
+  return n_packs * simd_pack_size;
+}
+
 /// Run transform with strides known at compile time.
 template <bool in_place, class Op, class... Operands, scipp::index... Strides>
-static void inner_loop(Op &&op,
-                       std::array<scipp::index, sizeof...(Operands)> indices,
-                       std::integer_sequence<scipp::index, Strides...>,
-                       const scipp::index n, Operands &&... operands) {
+static core::profiler::Loop
+inner_loop(Op &&op, std::array<scipp::index, sizeof...(Operands)> indices,
+           std::integer_sequence<scipp::index, Strides...> strides,
+           scipp::index n, Operands &&... operands) {
   static_assert(sizeof...(Operands) == sizeof...(Strides));
 
+  auto loop = core::profiler::Loop::Specialized;
+  if constexpr (is_simd_eligible_v<decltype(strides),
+                                    std::decay_t<Operands>...>) {
+    const auto done = vectorized_inner_loop<in_place, Strides...>(
+        op, indices, n, operands...);
+    constexpr std::array strides_{Strides...};
+    for (size_t k = 0; k < strides_.size(); ++k)
+      indices[k] += strides_[k] * done;
+    n -= done;
+    if (done > 0)
+      loop = core::profiler::Loop::Vectorized;
+  }
   for (scipp::index i = 0; i < n; ++i) {
     if constexpr (in_place) {
       detail::call_in_place(op, indices, std::forward<Operands>(operands)...);
@@ -195,14 +474,15 @@ static void inner_loop(Op &&op,
     }
     detail::increment<Strides...>(indices);
   }
+  return loop;
 }
 
 /// Run transform with strides known at run time but bypassing MultiIndex.
 template <bool in_place, class Op, class... Operands>
-static void inner_loop(Op &&op,
-                       std::array<scipp::index, sizeof...(Operands)> indices,
-                       const std::span<const scipp::index> strides,
-                       const scipp::index n, Operands &&... operands) {
+static core::profiler::Loop
+inner_loop(Op &&op, std::array<scipp::index, sizeof...(Operands)> indices,
+           const std::span<const scipp::index> strides, const scipp::index n,
+           Operands &&... operands) {
   for (scipp::index i = 0; i < n; ++i) {
     if constexpr (in_place) {
       detail::call_in_place(op, indices, std::forward<Operands>(operands)...);
@@ -211,29 +491,30 @@ static void inner_loop(Op &&op,
     }
     detail::increment(indices, strides);
   }
+  return core::profiler::Loop::Generic;
 }
 
 template <bool in_place, size_t I = 0, class Op, class... Operands>
-static void dispatch_inner_loop(
+static core::profiler::Loop dispatch_inner_loop(
     Op &&op, const std::array<scipp::index, sizeof...(Operands)> &indices,
     const std::span<const scipp::index> inner_strides, const scipp::index n,
     Operands &&... operands) {
   constexpr auto N_Operands = sizeof...(Operands);
   if constexpr (I ==
                 detail::stride_special_cases<N_Operands, in_place>.size()) {
-    inner_loop<in_place>(std::forward<Op>(op), indices, inner_strides, n,
-                         std::forward<Operands>(operands)...);
+    return inner_loop<in_place>(std::forward<Op>(op), indices, inner_strides,
+                                n, std::forward<Operands>(operands)...);
   } else {
     if (std::equal(
             inner_strides.begin(), inner_strides.end(),
             detail::stride_special_cases<N_Operands, in_place>[I].begin())) {
-      inner_loop<in_place>(
+      return inner_loop<in_place>(
           std::forward<Op>(op), indices,
           detail::make_stride_sequence<I, N_Operands, in_place>{}, n,
           std::forward<Operands>(operands)...);
     } else {
-      dispatch_inner_loop<in_place, I + 1>(op, indices, inner_strides, n,
-                                           std::forward<Operands>(operands)...);
+      return dispatch_inner_loop<in_place, I + 1>(
+          op, indices, inner_strides, n, std::forward<Operands>(operands)...);
     }
   }
 }
@@ -242,21 +523,28 @@ template <class Op, class Out, class... Ts>
 static void transform_elements(Op op, Out &&out, Ts &&... other) {
   const auto begin =
       core::MultiIndex(array_params(out), array_params(other)...);
+  auto *const scope = core::profiler::current();
 
   auto run = [&](auto &indices, const auto &end) {
     const auto inner_strides = indices.inner_strides();
+    core::profiler::TaskStats task;
     while (indices != end) {
       // Shape can change when moving between bins -> recompute every time.
       const auto inner_size = indices.in_same_chunk(end, 1)
                                   ? indices.inner_distance_to(end)
                                   : indices.inner_distance_to_end();
-      dispatch_inner_loop<false>(op, indices.get(), inner_strides, inner_size,
-                                 std::forward<Out>(out),
-                                 std::forward<Ts>(other)...);
+      task.add_chunk(dispatch_inner_loop<false>(op, indices.get(),
+                                                inner_strides, inner_size,
+                                                std::forward<Out>(out),
+                                                std::forward<Ts>(other)...),
+                     inner_size);
       indices.increment_by(inner_size != 0 ? inner_size : 1);
     }
+    record_task<false, Out, Ts...>(scope, task);
   };
 
+  if (begin.has_bins())
+    return parallel_for_bins(begin, element_cost<Out, Ts...>(), run);
   auto run_parallel = [&](const auto &range) {
     auto indices = begin;
     indices.set_index(range.begin());
@@ -264,8 +552,9 @@ static void transform_elements(Op op, Out &&out, Ts &&... other) {
     end.set_index(range.end());
     run(indices, end);
   };
-  core::parallel::parallel_for(core::parallel::blocked_range(0, out.size()),
-                               run_parallel);
+  core::parallel::parallel_for(
+      core::parallel::blocked_range(0, out.size(), element_cost<Out, Ts...>()),
+      run_parallel);
 }
 
 template <class T> static constexpr auto maybe_eval(T &&_) {
@@ -369,8 +658,29 @@ template <class T> struct as_view {
 };
 template <class T> as_view(T &data, const Dimensions &dims) -> as_view<T>;
 
+/// Temporary inputs of a transform whose buffers may be used for the output.
+using ReusableBuffers = std::array<Variable *, 2>;
+
+/// Return true if the buffer of `var` can be used for the output of a
+/// transform with given output dtype, dims, and variances.
+///
+/// `var` must be an input of the transform. Each output element then overwrites
+/// the input element it was computed from, which is safe for element-wise
+/// operations as long as `var` matches the output exactly and does not share
+/// its data with any other variable. This is restricted to arithmetic element
+/// types since other types such as Eigen expressions may be evaluated lazily.
+template <class Out>
+bool can_reuse_buffer(const Variable *var, const Dimensions &dims,
+                      const bool variances) {
+  return std::is_arithmetic_v<Out> && var != nullptr &&
+         var->dtype() == dtype<Out> && var->dims() == dims &&
+         var->hasVariances() == variances && !var->is_slice() &&
+         !var->is_readonly() && var->data_handle().use_count() == 1;
+}
+
 template <class Op> struct Transform {
   Op op;
+  ReusableBuffers buffers{};
   template <class... Ts> Variable operator()(Ts &&... handles) const {
     const auto dims = merge(handles.dims()...);
     using Out = decltype(maybe_eval(op(handles.values()[0]...)));
@@ -378,14 +688,25 @@ template <class Op> struct Transform {
         !std::is_base_of_v<core::transform_flags::no_out_variance_t, Op> &&
         core::canHaveVariances<Out>() && (handles.hasVariances() || ...);
     auto unit = op.base_op()(variableFactory().elem_unit(*handles.m_var)...);
-    auto out = variableFactory().create(dtype<Out>, dims, unit, variances,
-                                        *handles.m_var...);
+    const auto buffer =
+        std::find_if(buffers.begin(), buffers.end(), [&](const auto *var) {
+          return can_reuse_buffer<Out>(var, dims, variances);
+        });
+    Variable out;
+    if (buffer != buffers.end()) {
+      out = **buffer;
+      out.setUnit(unit);
+    } else {
+      out = variableFactory().create(dtype<Out>, dims, unit, variances,
+                                     *handles.m_var...);
+    }
     do_transform(op, variable_access<Out>(out), std::tuple<>(),
                  as_view{handles, dims}...);
     return out;
   }
 };
 template <class Op> Transform(Op) -> Transform<Op>;
+template <class Op> Transform(Op, ReusableBuffers) -> Transform<Op>;
 
 // std::tuple_cat does not work correctly on with clang-7. Issue with
 // Eigen::Vector3d.
@@ -431,6 +752,93 @@ constexpr auto overlaps = [](const auto &a, const auto &b) {
     return false;
 };
 
+namespace detail {
+/// True if `Types` allows for calling the operation with all arguments of type
+/// T, where the arguments have types Vars.
+template <class T, class Types, class... Vars> struct accepts_same_dtype;
+template <class T, class... Ts, class... Vars>
+struct accepts_same_dtype<T, std::tuple<Ts...>, Vars...> {
+  using same = visit_detail::maybe_duplicate<T, Vars...>;
+  static constexpr bool value =
+      (std::is_same_v<visit_detail::maybe_duplicate<Ts, Vars...>, same> || ...);
+};
+
+template <class Op, size_t... I>
+constexpr bool expects_variances(std::index_sequence<I...>) noexcept {
+  return (std::is_base_of_v<core::transform_flags::expect_variance_arg_t<I>,
+                            Op> ||
+          ...);
+}
+
+template <class T, class... Vars>
+bool is_dense_scalar(const Vars &... vars) {
+  return ((vars.dims().ndim() == 0 && vars.dtype() == dtype<T> &&
+           !vars.hasVariances()) &&
+          ...);
+}
+
+/// Fast path for transforming 0-D variables of the same fundamental dtype T
+/// without variances.
+///
+/// This bypasses the dtype dispatch, the variable factory, and the machinery
+/// for iterating arrays, which dominate the cost of operations on scalars.
+/// Returns false without doing anything if not applicable.
+template <class T, class Types, class Op, class... Vars>
+bool transform_scalar(Variable &out, Op op, const Vars &... vars) {
+  if constexpr (!accepts_same_dtype<T, Types, Vars...>::value ||
+                expects_variances<Op>(std::index_sequence_for<Vars...>{})) {
+    return false;
+  } else {
+    using Out = std::decay_t<decltype(op(
+        std::declval<std::conditional_t<true, const T &, Vars>>()...))>;
+    if constexpr (!std::is_arithmetic_v<Out>) {
+      return false;
+    } else {
+      if (!is_dense_scalar<T>(vars...))
+        return false;
+      const auto unit = op(vars.unit()...);
+      out = Variable(unit, Dimensions{},
+                     element_array<Out>(1, op(vars.template value<T>()...)),
+                     std::optional<element_array<Out>>{});
+      return true;
+    }
+  }
+}
+
+/// In-place variant of `transform_scalar`.
+///
+/// `vars` keep their constness, since cumulative operations write to them.
+template <class T, class Types, class Op, class Var, class... Vars>
+bool transform_scalar_in_place(Op op, Var &var, Vars &... vars) {
+  if constexpr (!accepts_same_dtype<T, Types, Var, Vars...>::value ||
+                expects_variances<Op>(
+                    std::index_sequence_for<Var, Vars...>{})) {
+    return false;
+  } else {
+    if (!is_dense_scalar<T>(var, vars...))
+      return false;
+    op(var.template value<T>(), vars.template value<T>()...);
+    return true;
+  }
+}
+
+template <class Types, class Op, class... Vars>
+bool transform_scalar_any(Variable &out, Op op, const Vars &... vars) {
+  return transform_scalar<double, Types>(out, op, vars...) ||
+         transform_scalar<float, Types>(out, op, vars...) ||
+         transform_scalar<int64_t, Types>(out, op, vars...) ||
+         transform_scalar<int32_t, Types>(out, op, vars...);
+}
+
+template <class Types, class Op, class... Vars>
+bool transform_scalar_in_place_any(Op op, Vars &... vars) {
+  return transform_scalar_in_place<double, Types>(op, vars...) ||
+         transform_scalar_in_place<float, Types>(op, vars...) ||
+         transform_scalar_in_place<int64_t, Types>(op, vars...) ||
+         transform_scalar_in_place<int32_t, Types>(op, vars...);
+}
+} // namespace detail
+
 /// Helper class wrapping functions for in-place transform.
 ///
 /// The dry_run template argument can be used to disable any actual modification
@@ -444,19 +852,23 @@ template <bool dry_run> struct in_place {
         core::MultiIndex(array_params(arg), array_params(other)...);
     if constexpr (dry_run)
       return;
+    auto *const scope = core::profiler::current();
 
     auto run = [&](auto &indices, const auto &end) {
       const auto inner_strides = indices.inner_strides();
+      core::profiler::TaskStats task;
       while (indices != end) {
         // Shape can change when moving between bins -> recompute every time.
         const auto inner_size = indices.in_same_chunk(end, 1)
                                     ? indices.inner_distance_to(end)
                                     : indices.inner_distance_to_end();
-        detail::dispatch_inner_loop<true>(op, indices.get(), inner_strides,
-                                          inner_size, std::forward<T>(arg),
-                                          std::forward<Ts>(other)...);
+        task.add_chunk(detail::dispatch_inner_loop<true>(
+                           op, indices.get(), inner_strides, inner_size,
+                           std::forward<T>(arg), std::forward<Ts>(other)...),
+                       inner_size);
         indices.increment_by(inner_size != 0 ? inner_size : 1);
       }
+      record_task<true, T, Ts...>(scope, task);
     };
     if (begin.has_stride_zero()) {
       // The output has a dimension with stride zero so parallelization must
@@ -465,6 +877,8 @@ template <bool dry_run> struct in_place {
       auto end = begin;
       end.set_index(arg.size());
       run(indices, end);
+    } else if (begin.has_bins()) {
+      parallel_for_bins(begin, element_cost<T, Ts...>(), run);
     } else {
       auto run_parallel = [&](const auto &range) {
         auto indices = begin; // copy so that run doesn't modify begin
@@ -473,8 +887,10 @@ template <bool dry_run> struct in_place {
         end.set_index(range.end());
         run(indices, end);
       };
-      core::parallel::parallel_for(core::parallel::blocked_range(0, arg.size()),
-                                   run_parallel);
+      core::parallel::parallel_for(
+          core::parallel::blocked_range(0, arg.size(),
+                                        element_cost<T, Ts...>()),
+          run_parallel);
     }
   }
 
@@ -591,6 +1007,12 @@ template <bool dry_run> struct in_place {
                              const std::string_view name, Var &&var,
                              Other &&... other) {
     using namespace detail;
+    const TransientWriteScope write_scope;
+    if constexpr (!dry_run &&
+                  std::is_same_v<std::decay_t<Var>, Variable>)
+      if (transform_scalar_in_place_any<std::tuple<Ts...>>(op, var,
+                                                          other...))
+        return;
     try {
       visit<Ts...>::apply(makeTransformInPlace(op), var, other...);
     } catch (const std::bad_variant_access &) {
@@ -603,6 +1025,9 @@ template <bool dry_run> struct in_place {
   static void transform(Op op, const std::string_view name, Var &&var,
                         const Other &... other) {
     using namespace detail;
+    std::optional<core::profiler::Scope> scope;
+    if constexpr (!dry_run)
+      scope.emplace(name);
     (scipp::expect::includes(var.dims(), other.dims()), ...);
     auto unit = variableFactory().elem_unit(var);
     op(unit, variableFactory().elem_unit(other)...);
@@ -673,15 +1098,25 @@ void transform_in_place(Var &&var, const Variable &other, Op op,
 namespace detail {
 template <class... Ts, class Op, class... Vars>
 Variable transform(std::tuple<Ts...> &&, Op op, const std::string_view name,
-                   const Vars &... vars) {
+                   const ReusableBuffers &buffers, const Vars &... vars) {
   using namespace detail;
+  const core::profiler::Scope scope(name);
+  const TransientWriteScope write_scope;
+  if (Variable out; transform_scalar_any<std::tuple<Ts...>>(out, op, vars...))
+    return out;
   try {
-    return visit<Ts...>::apply(Transform{wrap_eigen{op}}, vars...);
+    return visit<Ts...>::apply(Transform{wrap_eigen{op}, buffers}, vars...);
   } catch (const std::bad_variant_access &) {
     throw except::TypeError(
         "'" + std::string(name) + "' does not support dtypes ", vars...);
   }
 }
+
+template <class... Ts, class Op, class... Vars>
+Variable transform(std::tuple<Ts...> &&types, Op op,
+                   const std::string_view name, const Vars &... vars) {
+  return transform(std::move(types), op, name, ReusableBuffers{}, vars...);
+}
 } // namespace detail
 
 /// Transform the data elements of a variable and return a new Variable.
@@ -706,6 +1141,40 @@ template <class... Ts, class Op>
   return detail::transform(type_tuples<Ts...>(op), op, name, var1, var2);
 }
 
+/// Transform the data elements of two variables and return a new Variable.
+///
+/// Overload for a temporary first input. If it does not share its data with
+/// other variables and matches the dims, dtype, and variances of the output,
+/// its buffer is reused for the output instead of allocating a new one.
+template <class... Ts, class Op>
+[[nodiscard]] Variable transform(Variable &&var1, const Variable &var2, Op op,
+                                 const std::string_view name) {
+  return detail::transform(type_tuples<Ts...>(op), op, name,
+                           detail::ReusableBuffers{&var1, nullptr}, var1,
+                           var2);
+}
+
+/// Transform the data elements of two variables and return a new Variable.
+///
+/// Overload for a temporary second input, see above.
+template <class... Ts, class Op>
+[[nodiscard]] Variable transform(const Variable &var1, Variable &&var2, Op op,
+                                 const std::string_view name) {
+  return detail::transform(type_tuples<Ts...>(op), op, name,
+                           detail::ReusableBuffers{&var2, nullptr}, var1,
+                           var2);
+}
+
+/// Transform the data elements of two variables and return a new Variable.
+///
+/// Overload for two temporary inputs, see above.
+template <class... Ts, class Op>
+[[nodiscard]] Variable transform(Variable &&var1, Variable &&var2, Op op,
+                                 const std::string_view name) {
+  return detail::transform(type_tuples<Ts...>(op), op, name,
+                           detail::ReusableBuffers{&var1, &var2}, var1, var2);
+}
+
 /// Transform the data elements of three variables and return a new Variable.
 template <class... Ts, class Op>
 [[nodiscard]] Variable transform(const Variable &var1, const Variable &var2,
@@ -29,6 +29,8 @@ template <class... Types, class Op, class... Var>
 transform_subspan_impl(const DType type, const Dim dim, const scipp::index size,
                        Op op, const std::string_view &name, Var... var) {
   using namespace transform_subspan_detail;
+  // Covers the subspan view of `out`, which does not outlive this call.
+  const detail::TransientWriteScope write_scope;
 
   auto dims =
       merge(var.dims().contains(dim) ? erase(var.dims(), dim) : var.dims()...);
@@ -9,6 +9,7 @@
 #include "scipp-variable_export.h"
 #include "scipp/variable/generated_util.h"
 #include "scipp/variable/variable.h"
+#include "scipp/variable/variable_concept.h"
 
 namespace scipp::variable {
 
@@ -28,6 +29,12 @@ issorted(const Variable &x, const Dim dim,
 allsorted(const Variable &x, const Dim dim,
           const SortOrder order = SortOrder::Ascending);
 
+[[nodiscard]] SCIPP_VARIABLE_EXPORT bool alllinspace(const Variable &x,
+                                                     const Dim dim);
+
+[[nodiscard]] SCIPP_VARIABLE_EXPORT EdgeProperties
+edge_properties(const Variable &x, const Dim dim);
+
 [[nodiscard]] SCIPP_VARIABLE_EXPORT Variable zip(const Variable &first,
                                                  const Variable &second);
 
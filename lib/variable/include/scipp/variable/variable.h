@@ -7,6 +7,7 @@
 #include <optional>
 #include <span>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -32,6 +33,8 @@ namespace scipp::variable {
 
 class VariableConcept;
 using VariableConceptHandle = std::shared_ptr<VariableConcept>;
+/// Buffers already accounted for when computing memory usage.
+using BufferSet = std::unordered_set<const void *>;
 
 /// Variable is a type-erased handle to any data structure representing a
 /// multi-dimensional array. In addition it has a unit and a set of dimension
@@ -140,6 +143,10 @@ public:
 
   [[nodiscard]] Variable as_const() const;
 
+  /// Return memory of buffers referenced by the variable. Slices keep the
+  /// full buffer alive, so its full size is reported.
+  [[nodiscard]] core::MemoryUsage memory_usage() const;
+
   auto &unchecked_dims() { return m_dims; }
   auto &unchecked_strides() { return m_strides; }
 
@@ -161,6 +168,11 @@ private:
   bool m_readonly{false};
 };
 
+/// Return memory of buffers of `var` not contained in `seen`, adding them to
+/// `seen`. Used to count buffers shared between variables only once.
+[[nodiscard]] SCIPP_VARIABLE_EXPORT core::MemoryUsage
+memory_usage(const Variable &var, BufferSet &seen);
+
 /// Factory function for Variable supporting "keyword arguments"
 ///
 /// Two styles are supported:
@@ -8,9 +8,12 @@
 #include "scipp/common/index.h"
 #include "scipp/core/dimensions.h"
 #include "scipp/core/dtype.h"
+#include "scipp/core/memory_usage.h"
 #include "scipp/units/unit.h"
+#include "scipp/variable/variable.h"
 
 #include <memory>
+#include <optional>
 
 namespace scipp::variable {
 
@@ -19,6 +22,38 @@ class VariableConcept;
 
 using VariableConceptHandle = std::shared_ptr<VariableConcept>;
 
+/// Properties of the values of a variable along a dimension, as required for
+/// bin edges.
+struct EdgeProperties {
+  /// All subspans along the dimension are sorted in ascending order.
+  bool ascending{false};
+  /// All subspans along the dimension are sorted in descending order.
+  bool descending{false};
+  /// All subspans along the dimension are strictly increasing and have constant
+  /// spacing, see `numeric::islinspace`.
+  bool linspace{false};
+  /// All subspans along the dimension are strictly increasing and have constant
+  /// ratio of neighbors, see `numeric::islogspace`. Not set if `linspace`.
+  bool logspace{false};
+};
+
+namespace detail {
+/// Marks write access handed out to the calling thread as transient.
+///
+/// Operations such as `transform` create views for writing that do not outlive
+/// the call. While a scope is alive such write access does not pin buffers,
+/// whereas any other write access does, since the views may be used after the
+/// model was copied. See `VariableConcept::pin_buffers`.
+class SCIPP_VARIABLE_EXPORT TransientWriteScope {
+public:
+  TransientWriteScope() noexcept;
+  TransientWriteScope(const TransientWriteScope &) = delete;
+  TransientWriteScope &operator=(const TransientWriteScope &) = delete;
+  ~TransientWriteScope();
+  [[nodiscard]] static bool active() noexcept;
+};
+} // namespace detail
+
 /// Abstract base class for any data that can be held by Variable. This is using
 /// so-called concept-based polymorphism, see talks by Sean Parent.
 ///
@@ -36,6 +71,17 @@ public:
   virtual ~VariableConcept() = default;
 
   virtual VariableConceptHandle clone() const = 0;
+  /// Return a deep copy of the model that shares buffers with this model until
+  /// either is written to, or nullptr if the model does not support this.
+  virtual VariableConceptHandle copy_on_write() const { return nullptr; }
+  /// Mark buffers as referenced outside of scipp, e.g., by a numpy array.
+  /// Buffers that are currently shared with copies are detached first. Pinned
+  /// buffers are never shared with copies of the model.
+  virtual void pin_buffers() {}
+  /// Mark buffers as referenced read-only outside of scipp, e.g., by a
+  /// read-only numpy array. Such buffers may be shared with copies, but are
+  /// kept alive when the model replaces them by a copy before writing.
+  virtual void reference_buffers() {}
   virtual VariableConceptHandle
   makeDefaultFromParent(const scipp::index size) const = 0;
   virtual VariableConceptHandle
@@ -57,6 +103,19 @@ public:
   virtual scipp::index dtype_size() const = 0;
 
   virtual const VariableConceptHandle &bin_indices() const = 0;
+  /// Return memory of buffers not in `seen` and add them to `seen`.
+  virtual core::MemoryUsage memory_usage(BufferSet &seen) const = 0;
+  /// Return true if edge properties of the values may be cached.
+  virtual bool can_cache_edge_properties() const { return false; }
+  /// Return edge properties along `dim` of all values with shape `dims`, if
+  /// cached and not invalidated by write access since.
+  virtual std::optional<EdgeProperties>
+  cached_edge_properties(const Dimensions &, const Dim) const {
+    return std::nullopt;
+  }
+  /// Cache edge properties along `dim` of all values with shape `dims`.
+  virtual void cache_edge_properties(const Dimensions &, const Dim,
+                                     const EdgeProperties &) const {}
 
   friend class Variable;
 
@@ -2,6 +2,8 @@
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock
+#include <algorithm>
+
 #include "scipp/core/element/geometric_operations.h"
 #include "scipp/core/element/special_values.h"
 #include "scipp/core/element/util.h"
@@ -16,8 +18,22 @@ using namespace scipp::core;
 
 namespace scipp::variable {
 
+namespace {
+bool is_contiguous(const Variable &var) {
+  const Strides strides(var.dims());
+  return !var.is_slice() && std::equal(var.strides().begin(),
+                                       var.strides().end(), strides.begin());
+}
+} // namespace
+
 /// Return a deep copy of a Variable.
+///
+/// If `var` is not a slice its buffer is shared with the copy until either of
+/// them is written to, provided that the dtype supports this.
 Variable copy(const Variable &var) {
+  if (is_contiguous(var))
+    if (auto shared = var.data().copy_on_write())
+      return Variable(var.dims(), std::move(shared));
   Variable out(empty_like(var));
   out.data().copy(var, out);
   return out;
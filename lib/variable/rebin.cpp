@@ -2,11 +2,15 @@
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 /// @file
 /// @author Simon Heybrock, Igor Gudich
+#include <algorithm>
+#include <numeric>
+
 #include "scipp/core/element/rebin.h"
 #include "scipp/core/parallel.h"
 #include "scipp/units/except.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/astype.h"
+#include "scipp/variable/creation.h"
 #include "scipp/variable/rebin.h"
 #include "scipp/variable/reduction.h"
 #include "scipp/variable/shape.h"
@@ -104,8 +108,190 @@ auto as_contiguous(const Variable &var, const Dim dim) {
   dims.addInner(dim, var.dims()[dim]);
   return copy(transpose(var, dims.labels()));
 }
+
+/// Number of elements of the dims inner to the rebinned dim that are processed
+/// together by `Rebinner`, such that the block of every old and new bin stays
+/// in cache while accumulating.
+constexpr scipp::index rebin_block = 256;
 } // namespace
 
+/// Resample `var` from bins given by `oldCoord` to bins given by `newCoord`.
+///
+/// `Sum` is equivalent to `rebin`, i.e., treats data as counts. The other modes
+/// treat data as piecewise constant: `Mean` computes the mean of the data in
+/// each new bin weighted by the overlap with the old bins, `Max` and `Min`
+/// select the extreme value of all overlapping old bins. Variances are
+/// propagated for `Mean` and are those of the selected value for `Max` and
+/// `Min`.
+Variable resample(const Variable &var, const Dim dim, const Variable &oldCoord,
+                  const Variable &newCoord, const ResampleMode mode) {
+  if (mode == ResampleMode::Sum)
+    return rebin(var, dim, oldCoord, newCoord);
+  if (!isBinEdge(dim, oldCoord.dims(), var.dims()))
+    throw except::BinEdgeError(
+        "The input does not have coordinates with bin-edges.");
+  if (is_bins(var))
+    throw except::TypeError("The input variable cannot be binned data. Use "
+                            "`bin` or `histogram` instead of `resample`.");
+  if (mode == ResampleMode::Mean && is_int(var.dtype()))
+    return resample(astype(var, dtype<double>), dim, oldCoord, newCoord, mode);
+  // The kernels require stride 1 for data and edges, see `rebin`.
+  if (var.stride(dim) != 1)
+    return copy(transpose(resample(as_contiguous(var, dim), dim, oldCoord,
+                                   newCoord, mode),
+                          var.dims().labels()));
+  const bool ascending = allsorted(oldCoord, dim, SortOrder::Ascending) &&
+                         allsorted(newCoord, dim, SortOrder::Ascending);
+  if (!ascending && !(allsorted(oldCoord, dim, SortOrder::Descending) &&
+                      allsorted(newCoord, dim, SortOrder::Descending)))
+    throw except::BinEdgeError(
+        "Resample: The old or new bin edges are not sorted.");
+  const auto oldEdges = as_contiguous(oldCoord, dim);
+  const auto newEdges = as_contiguous(newCoord, dim);
+  const auto nbin = newEdges.dims()[dim] - 1;
+  const auto apply = [&](const auto &kernel) {
+    return transform_subspan(var.dtype(), dim, nbin, newEdges, var, oldEdges,
+                             kernel, "resample");
+  };
+  Variable resampled;
+  if (mode == ResampleMode::Mean)
+    resampled = ascending ? apply(core::element::resample_mean<Less>)
+                          : apply(core::element::resample_mean<Greater>);
+  else if (mode == ResampleMode::Max)
+    resampled = ascending ? apply(core::element::resample_max<Less>)
+                          : apply(core::element::resample_max<Greater>);
+  else
+    resampled = ascending ? apply(core::element::resample_min<Less>)
+                          : apply(core::element::resample_min<Greater>);
+  // As in `rebin`, retain the input dimension order.
+  return transpose(resampled, var.dims().labels());
+}
+
+Rebinner::Rebinner(const Dim dim, const Variable &oldCoord,
+                   const Variable &newCoord)
+    : m_dim(dim) {
+  if (oldCoord.dims().ndim() != 1 || newCoord.dims().ndim() != 1)
+    throw except::DimensionError("Rebinner requires 1-D bin edges.");
+  if (oldCoord.dtype() != dtype<double> || newCoord.dtype() != dtype<double>)
+    throw except::TypeError("Rebinner requires bin edges of type `float64`.");
+  if (oldCoord.unit() != newCoord.unit())
+    throw except::UnitError(
+        "Input and output bin edges must have the same unit.");
+  const bool ascending = allsorted(oldCoord, dim, SortOrder::Ascending) &&
+                         allsorted(newCoord, dim, SortOrder::Ascending);
+  if (!ascending && !(allsorted(oldCoord, dim, SortOrder::Descending) &&
+                      allsorted(newCoord, dim, SortOrder::Descending)))
+    throw except::BinEdgeError(
+        "Rebin: The old or new bin edges are not sorted.");
+  const auto oldEdges = as_contiguous(oldCoord, dim);
+  const auto newEdges = as_contiguous(newCoord, dim);
+  const auto xold = oldEdges.values<double>().as_span();
+  const auto xnew = newEdges.values<double>().as_span();
+  m_old_size = scipp::size(xold) - 1;
+  const auto newSize = scipp::size(xnew) - 1;
+  m_first.assign(newSize, 0);
+  m_offsets.assign(newSize + 1, 0);
+  // Overlaps are visited ordered by new bin, so the weights of every new bin
+  // are contiguous. Count them first and turn the counts into offsets below.
+  const auto add_overlap = [&](const scipp::index inew,
+                               const scipp::index iold, const double delta,
+                               const double owidth) {
+    if (m_offsets[inew + 1]++ == 0)
+      m_first[inew] = iold;
+    m_weights.push_back(delta / owidth);
+  };
+  if (ascending)
+    rebin_detail::for_each_overlap<Less>(xnew, xold, add_overlap);
+  else
+    rebin_detail::for_each_overlap<Greater>(xnew, xold, add_overlap);
+  std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+}
+
+/// Return true if `var` can be rebinned by a `Rebinner` for the given edges.
+bool Rebinner::supports(const Variable &var, const Variable &oldCoord,
+                        const Variable &newCoord) {
+  const auto type = var.dtype();
+  return oldCoord.dims().ndim() == 1 && newCoord.dims().ndim() == 1 &&
+         oldCoord.dtype() == dtype<double> &&
+         newCoord.dtype() == dtype<double> &&
+         (type == dtype<double> || type == dtype<float> ||
+          type == dtype<int64_t> || type == dtype<int32_t>);
+}
+
+/// Apply the overlap matrix to the values and variances of `in`.
+///
+/// `in` must have default strides. The product is computed for blocks of the
+/// inner dims, in parallel over outer dims and blocks. Every output element
+/// accumulates the same terms in the same order as `core::element::rebin`, so
+/// results are identical.
+template <class Out, class In>
+void Rebinner::apply(Variable &out, const Variable &in) const {
+  const auto &dims = in.dims();
+  const auto index = dims.index(m_dim);
+  scipp::index outer = 1;
+  scipp::index inner = 1;
+  for (scipp::index i = 0; i < index; ++i)
+    outer *= dims.size(i);
+  for (scipp::index i = index + 1; i < dims.ndim(); ++i)
+    inner *= dims.size(i);
+  const auto newSize = scipp::size(m_first);
+  const auto nblock = (inner + rebin_block - 1) / rebin_block;
+  const auto product = [&](const auto &out_values, const auto &in_values) {
+    const auto rebin_blocks = [&](const auto &range) {
+      for (auto b = range.begin(); b < range.end(); ++b) {
+        const auto begin = (b % nblock) * rebin_block;
+        const auto end = std::min(begin + rebin_block, inner);
+        const In *in_outer = in_values.data() + b / nblock * m_old_size * inner;
+        Out *out_outer = out_values.data() + b / nblock * newSize * inner;
+        for (scipp::index inew = 0; inew < newSize; ++inew) {
+          Out *row = out_outer + inew * inner;
+          std::fill(row + begin, row + end, Out{0});
+          for (auto k = m_offsets[inew]; k < m_offsets[inew + 1]; ++k) {
+            const In *old_row =
+                in_outer + (m_first[inew] + k - m_offsets[inew]) * inner;
+            const auto scale = m_weights[k];
+            for (auto i = begin; i < end; ++i)
+              row[i] += old_row[i] * scale;
+          }
+        }
+      }
+    };
+    core::parallel::parallel_for(
+        core::parallel::blocked_range(0, outer * nblock), rebin_blocks);
+  };
+  product(out.values<Out>().as_span(), in.values<In>().as_span());
+  if (in.hasVariances())
+    product(out.variances<Out>().as_span(), in.variances<In>().as_span());
+}
+
+Variable Rebinner::operator()(const Variable &var) const {
+  if (is_bins(var))
+    throw except::TypeError("The input variable cannot be binned data. Use "
+                            "`bin` or `histogram` instead of `rebin`.");
+  if (!var.dims().contains(m_dim) || var.dims()[m_dim] != m_old_size)
+    throw except::BinEdgeError(
+        "The input does not have coordinates with bin-edges.");
+  const auto in = core::Strides(var.strides()) == core::Strides(var.dims())
+                      ? var
+                      : copy(var);
+  auto dims = var.dims();
+  dims.resize(m_dim, scipp::size(m_first));
+  const auto out_type = is_int(var.dtype()) ? dtype<double> : var.dtype();
+  auto out = empty(dims, var.unit(), out_type, var.hasVariances());
+  if (var.dtype() == dtype<double>)
+    apply<double, double>(out, in);
+  else if (var.dtype() == dtype<float>)
+    apply<float, float>(out, in);
+  else if (var.dtype() == dtype<int64_t>)
+    apply<double, int64_t>(out, in);
+  else if (var.dtype() == dtype<int32_t>)
+    apply<double, int32_t>(out, in);
+  else
+    throw except::TypeError("Rebinner does not support data of type " +
+                            to_string(var.dtype()) + '.');
+  return out;
+}
+
 Variable rebin(const Variable &var, const Dim dim, const Variable &oldCoord,
                const Variable &newCoord) {
   // The code branch dealing with non-stride-1 data cannot handle non-1D edges.
@@ -129,6 +315,10 @@ Variable rebin(const Variable &var, const Dim dim, const Variable &oldCoord,
   if (is_bins(var))
     throw except::TypeError("The input variable cannot be binned data. Use "
                             "`bin` or `histogram` instead of `rebin`.");
+  // Shared 1-D edges are the common case, the overlap of bins is then computed
+  // once for all spectra instead of separately for every spectrum.
+  if (Rebinner::supports(var, oldCoord, newCoord))
+    return Rebinner(dim, oldCoord, newCoord)(var);
 
   using transform_args = std::tuple<
       args<double, double, int64_t, double>,
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
+#include <utility>
 
 #include "test_macros.h"
 
@@ -19,9 +20,12 @@ protected:
     EXPECT_EQ(a, b);
     EXPECT_NE(&a.dims(), &b.dims());
     EXPECT_NE(&a.unit(), &b.unit());
-    EXPECT_NE(a.values<double>().data(), b.values<double>().data());
+    // Buffers may be shared until written to, so request write access.
+    Variable written(a);
+    EXPECT_NE(written.values<double>().data(), b.values<double>().data());
     if (a.hasVariances()) {
-      EXPECT_NE(a.variances<double>().data(), b.variances<double>().data());
+      EXPECT_NE(written.variances<double>().data(),
+                b.variances<double>().data());
     }
   }
 
@@ -85,3 +89,117 @@ TEST_F(CopyTest, broadcast_transpose_slice) {
   EXPECT_EQ(copied.data().size(), 8);
   EXPECT_TRUE(equals(var.values<double>(), {5, 8, 5, 8, 6, 9, 6, 9}));
 }
+
+TEST_F(CopyTest, full_shares_buffer_until_written) {
+  const auto copied = copy(xy);
+  const auto &original = std::as_const(xy);
+  EXPECT_EQ(copied.values<double>().data(), original.values<double>().data());
+  EXPECT_EQ(copied.variances<double>().data(),
+            original.variances<double>().data());
+  variable::BufferSet seen;
+  EXPECT_EQ(variable::memory_usage(xy, seen).bytes, 18 * sizeof(double));
+  EXPECT_EQ(variable::memory_usage(copied, seen).bytes, 0);
+}
+
+TEST_F(CopyTest, writing_to_copy_does_not_modify_original) {
+  const auto original = copy(xy);
+  auto copied = copy(xy);
+  copied.values<double>()[0] = -1.0;
+  copied.variances<double>()[0] = -1.0;
+  EXPECT_EQ(xy, original);
+  EXPECT_EQ(copied.values<double>()[0], -1.0);
+  EXPECT_EQ(copied.variances<double>()[0], -1.0);
+  EXPECT_EQ(copied.values<double>()[1], 2.0);
+}
+
+TEST_F(CopyTest, writing_to_original_does_not_modify_copy) {
+  const auto copied = copy(xy);
+  xy += xy;
+  EXPECT_NE(xy, copied);
+  EXPECT_TRUE(equals(copied.values<double>(), {1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST_F(CopyTest, writing_to_slice_of_copy_does_not_modify_original) {
+  auto copied = copy(xy);
+  copied.slice({Dim::X, 1}) *= 2.0 * units::one;
+  EXPECT_EQ(xy.values<double>()[3], 4.0);
+  EXPECT_EQ(copied.values<double>()[3], 8.0);
+}
+
+TEST_F(CopyTest, set_unit_of_copy_does_not_modify_original) {
+  auto copied = copy(xy);
+  copied.setUnit(units::s);
+  EXPECT_EQ(xy.unit(), units::m);
+  EXPECT_EQ(std::as_const(copied).values<double>().data(),
+            std::as_const(xy).values<double>().data());
+}
+
+TEST_F(CopyTest, pinned_buffer_is_not_shared) {
+  xy.data_handle()->pin_buffers();
+  const auto copied = copy(xy);
+  EXPECT_NE(copied.values<double>().data(),
+            std::as_const(xy).values<double>().data());
+  EXPECT_EQ(copied, xy);
+}
+
+TEST_F(CopyTest, referenced_buffer_is_shared_until_written) {
+  xy.data_handle()->reference_buffers();
+  auto copied = copy(xy);
+  const auto *data = std::as_const(xy).values<double>().data();
+  EXPECT_EQ(std::as_const(copied).values<double>().data(), data);
+  xy += xy;
+  EXPECT_NE(std::as_const(xy).values<double>().data(), data);
+  EXPECT_EQ(std::as_const(copied).values<double>().data(), data);
+  EXPECT_EQ(copied.values<double>()[1], 2.0);
+}
+
+TEST_F(CopyTest, write_view_obtained_before_copy_does_not_modify_copy) {
+  auto view = xy.values<double>();
+  const auto copied = copy(xy);
+  view[0] = -1.0;
+  EXPECT_EQ(copied.values<double>()[0], 1.0);
+  EXPECT_EQ(std::as_const(xy).values<double>()[0], -1.0);
+}
+
+TEST_F(CopyTest, transform_output_shares_buffer_until_written) {
+  const auto sum = xy + xy;
+  const auto copied = copy(sum);
+  EXPECT_EQ(copied.values<double>().data(), sum.values<double>().data());
+}
+
+TEST_F(CopyTest, scalar_is_copied_eagerly) {
+  auto scalar = makeVariable<double>(units::m, Values{1.0}, Variances{2.0});
+  const auto copied = copy(scalar);
+  EXPECT_NE(copied.values<double>().data(),
+            std::as_const(scalar).values<double>().data());
+  scalar.values<double>()[0] = 3.0;
+  scalar.variances<double>()[0] = 4.0;
+  EXPECT_EQ(copied.value<double>(), 1.0);
+  EXPECT_EQ(copied.variance<double>(), 2.0);
+  variable::BufferSet seen;
+  EXPECT_EQ(variable::memory_usage(scalar, seen).bytes, 2 * sizeof(double));
+  EXPECT_EQ(variable::memory_usage(copied, seen).bytes, 2 * sizeof(double));
+}
+
+TEST_F(CopyTest, pin_buffers_detaches_shared_buffer) {
+  const auto copied = copy(xy);
+  const auto *data = copied.values<double>().data();
+  xy.data_handle()->pin_buffers();
+  const auto *pinned = std::as_const(xy).values<double>().data();
+  EXPECT_NE(pinned, data);
+  EXPECT_EQ(copied.values<double>().data(), data);
+  // Pinned buffers are written in place.
+  xy += xy;
+  EXPECT_EQ(std::as_const(xy).values<double>().data(), pinned);
+  EXPECT_EQ(copied.values<double>()[1], 2.0);
+}
+
+TEST_F(CopyTest, string_shares_buffer_until_written) {
+  const auto var = makeVariable<std::string>(Dims{Dim::X}, Shape{2},
+                                             Values{"a", "b"});
+  auto copied = copy(var);
+  EXPECT_EQ(std::as_const(copied).values<std::string>().data(),
+            var.values<std::string>().data());
+  copied.values<std::string>()[0] = "c";
+  EXPECT_EQ(var.values<std::string>()[0], "a");
+}
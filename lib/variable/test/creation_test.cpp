@@ -2,7 +2,12 @@
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
 
+#include <filesystem>
+#include <fstream>
+
 #include "scipp/variable/creation.h"
+#include "scipp/variable/except.h"
+#include "scipp/variable/reduction.h"
 #include "test_macros.h"
 #include "test_variables.h"
 
@@ -156,3 +161,79 @@ TEST(CreationTest, special_like_time_point) {
                 units::ns,
                 Values{time_point(std::numeric_limits<int64_t>::lowest())}));
 }
+
+class MapFileTest : public ::testing::Test {
+protected:
+  MapFileTest() {
+    std::ofstream file(path, std::ios::binary);
+    const std::vector<double> data{1, 2, 3, 4, 5, 6, 0.1, 0.2, 0.3,
+                                   0.4, 0.5, 0.6};
+    file.write(reinterpret_cast<const char *>(data.data()),
+               data.size() * sizeof(double));
+  }
+  ~MapFileTest() override { std::filesystem::remove(path); }
+
+  std::string path =
+      (std::filesystem::temp_directory_path() / "scipp_map_file_test.bin")
+          .string();
+  Dimensions dims{{Dim::Y, Dim::X}, {2, 3}};
+};
+
+TEST_F(MapFileTest, values) {
+  const auto var = map_file(path, dims, units::m, dtype<double>);
+  EXPECT_TRUE(var.is_readonly());
+  EXPECT_EQ(var, makeVariable<double>(dims, units::m,
+                                      Values{1, 2, 3, 4, 5, 6}));
+}
+
+TEST_F(MapFileTest, values_and_variances) {
+  const auto var = map_file(path, dims, units::m, dtype<double>, 0,
+                            6 * sizeof(double));
+  EXPECT_EQ(var, makeVariable<double>(dims, units::m, Values{1, 2, 3, 4, 5, 6},
+                                      Variances{0.1, 0.2, 0.3, 0.4, 0.5, 0.6}));
+}
+
+TEST_F(MapFileTest, offset_and_other_dtype) {
+  const auto var =
+      map_file(path, Dimensions(Dim::X, 4), units::one, dtype<int64_t>,
+               8 * sizeof(double));
+  EXPECT_EQ(var.dtype(), dtype<int64_t>);
+  EXPECT_EQ(var.dims(), Dimensions(Dim::X, 4));
+}
+
+TEST_F(MapFileTest, slice_and_reduce) {
+  const auto var = map_file(path, dims, units::m, dtype<double>);
+  EXPECT_EQ(var.slice({Dim::Y, 1}),
+            makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m,
+                                 Values{4, 5, 6}));
+  EXPECT_EQ(sum(var), makeVariable<double>(units::m, Values{21}));
+}
+
+TEST_F(MapFileTest, read_only_cannot_be_modified) {
+  const auto var = map_file(path, dims, units::m, dtype<double>);
+  auto shallow_copy = var;
+  EXPECT_THROW_DISCARD(shallow_copy.values<double>(), except::VariableError);
+  auto copied = copy(var);
+  EXPECT_FALSE(copied.is_readonly());
+  copied.values<double>()[0] = 10.0;
+  EXPECT_EQ(var.values<double>()[0], 1.0);
+}
+
+TEST_F(MapFileTest, copy_on_write) {
+  auto var = map_file(path, dims, units::m, dtype<double>, 0, std::nullopt,
+                      core::MapMode::CopyOnWrite);
+  EXPECT_FALSE(var.is_readonly());
+  var.values<double>()[0] = 10.0;
+  EXPECT_EQ(var.values<double>()[0], 10.0);
+  const auto original = map_file(path, dims, units::m, dtype<double>);
+  EXPECT_EQ(original.values<double>()[0], 1.0);
+}
+
+TEST_F(MapFileTest, exceeding_file_size_throws) {
+  EXPECT_THROW_DISCARD(
+      map_file(path, Dimensions(Dim::X, 13), units::m, dtype<double>),
+      std::out_of_range);
+  EXPECT_THROW_DISCARD(map_file(path, dims, units::m, dtype<double>, 0,
+                                7 * sizeof(double)),
+                       std::out_of_range);
+}
@@ -28,6 +28,17 @@ TEST(CumulativeTest, cumsum) {
             makeVariable<int64_t>(var.dims(), Values{0, 1, 3, 6, 10, 15}));
 }
 
+TEST(CumulativeTest, cumsum_0d) {
+  const auto var = makeVariable<double>(Values{2.5}, units::m);
+  EXPECT_EQ(cumsum(var), var);
+  EXPECT_EQ(cumsum(var, CumSumMode::Exclusive),
+            makeVariable<double>(Values{0.0}, units::m));
+  const auto ints = makeVariable<int64_t>(Values{3});
+  EXPECT_EQ(cumsum(ints), ints);
+  EXPECT_EQ(cumsum(ints, CumSumMode::Exclusive),
+            makeVariable<int64_t>(Values{0}));
+}
+
 TEST(CumulativeTest, cumsum_bins) {
   const auto indices =
       makeVariable<scipp::index_pair>(Values{scipp::index_pair{0, 3}});
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+#include <gtest/gtest.h>
+
+#include "test_macros.h"
+
+#include "scipp/variable/arithmetic.h"
+#include "scipp/variable/astype.h"
+#include "scipp/variable/bins.h"
+#include "scipp/variable/except.h"
+#include "scipp/variable/fuse.h"
+#include "scipp/variable/math.h"
+
+using namespace scipp;
+using namespace scipp::variable;
+
+class FuseTest : public ::testing::Test {
+protected:
+  Variable a = makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m,
+                                    Values{1, 2, 3}, Variances{0.1, 0.2, 0.3});
+  Variable b = makeVariable<double>(Dims{Dim::X}, Shape{3}, units::s,
+                                    Values{4, 5, 6}, Variances{0.4, 0.5, 0.6});
+  Variable c = makeVariable<double>(Dims{Dim::Y}, Shape{2}, units::m,
+                                    Values{7, 8}, Variances{0.7, 0.8});
+  Variable d = makeVariable<double>(units::s, Values{9}, Variances{0.9});
+};
+
+TEST_F(FuseTest, single_input) {
+  EXPECT_EQ(fuse(a).eval(), a);
+  EXPECT_EQ(Variable(-fuse(a)), -a);
+  EXPECT_EQ(Variable(sqrt(fuse(a))), sqrt(a));
+}
+
+TEST_F(FuseTest, matches_eager_evaluation) {
+  const Variable fused = fuse(a) * fuse(b) + fuse(c) * fuse(d);
+  EXPECT_EQ(fused, a * b + c * d);
+}
+
+TEST_F(FuseTest, variables_as_operands) {
+  EXPECT_EQ(Variable(fuse(a) * b + c * fuse(d)), a * b + c * d);
+  EXPECT_EQ(Variable(fuse(a) / b - c / fuse(d)), a / b - c / d);
+}
+
+TEST_F(FuseTest, repeated_input) {
+  EXPECT_EQ(Variable(fuse(a) * a + a), a * a + a);
+}
+
+TEST_F(FuseTest, math) {
+  const auto x = a / c;
+  EXPECT_EQ(Variable(abs(-fuse(x))), abs(-x));
+  EXPECT_EQ(Variable(reciprocal(fuse(a) * b)), reciprocal(a * b));
+  EXPECT_EQ(Variable(exp(fuse(x))), exp(x));
+  EXPECT_EQ(Variable(log(fuse(x))), log(x));
+  EXPECT_EQ(Variable(log10(fuse(x))), log10(x));
+}
+
+TEST_F(FuseTest, float32) {
+  const auto af = astype(a, dtype<float>);
+  const auto bf = astype(b, dtype<float>);
+  EXPECT_EQ(Variable(fuse(af) * fuse(bf) + af), af * bf + af);
+}
+
+TEST_F(FuseTest, unit_error) {
+  EXPECT_THROW_DISCARD(Variable(fuse(a) + b), except::UnitError);
+}
+
+TEST_F(FuseTest, dtype_error) {
+  const auto i = makeVariable<int64_t>(Dims{Dim::X}, Shape{3}, units::m,
+                                       Values{1, 2, 3});
+  EXPECT_THROW_DISCARD(Variable(fuse(a) + i), except::TypeError);
+}
+
+TEST_F(FuseTest, binned) {
+  const auto indices = makeVariable<scipp::index_pair>(
+      Dims{Dim::Y}, Shape{2}, Values{std::pair{0, 2}, std::pair{2, 3}});
+  const auto binned = make_bins(indices, Dim::X, copy(a));
+  const auto scale = makeVariable<double>(Dims{Dim::Y}, Shape{2}, units::s,
+                                          Values{2, 3});
+  EXPECT_EQ(Variable(fuse(binned) * scale + binned * fuse(d)),
+            binned * scale + binned * d);
+}
@@ -1,15 +1,25 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
-
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <span>
+#include <vector>
+
+#include "scipp/core/element/rebin.h"
+#include "scipp/core/value_and_variance.h"
 #include "scipp/variable/astype.h"
 #include "scipp/variable/bins.h"
 #include "scipp/variable/rebin.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/variable.h"
 
 #include "test_macros.h"
 
 using namespace scipp;
+using namespace scipp::variable;
 
 TEST(RebinTest, inner) {
   const auto base = makeVariable<double>(Dims{Dim::X}, Shape{2}, units::counts,
@@ -241,3 +251,203 @@ TEST(Variable, check_rebin_cannot_be_used_on_bin_data) {
       makeVariable<double>(Dimensions{Dim::Y, 4}, Values{0, 1, 2, 3});
   EXPECT_THROW_DISCARD(rebin(var, Dim::Y, oldEdge, newEdge), except::TypeError);
 }
+
+class RebinnerTest : public ::testing::Test {
+protected:
+  Variable oldEdges =
+      makeVariable<double>(Dims{Dim::Y}, Shape{5}, Values{0, 1, 2, 3, 4});
+  Variable newEdges =
+      makeVariable<double>(Dims{Dim::Y}, Shape{3}, Values{0.5, 2.0, 4.5});
+  Variable var = makeVariable<double>(
+      Dims{Dim::Y, Dim::X}, Shape{4, 2}, units::counts,
+      Values{1, 2, 3, 4, 5, 6, 7, 8}, Variances{1, 1, 2, 2, 3, 3, 4, 4});
+  Variable expected = makeVariable<double>(
+      Dims{Dim::Y, Dim::X}, Shape{2, 2}, units::counts,
+      Values{3.5, 5.0, 12.0, 14.0}, Variances{2.5, 2.5, 7.0, 7.0});
+};
+
+TEST_F(RebinnerTest, outer) {
+  const Rebinner rebinner(Dim::Y, oldEdges, newEdges);
+  EXPECT_EQ(rebinner.dim(), Dim::Y);
+  EXPECT_EQ(rebinner(var), expected);
+  EXPECT_EQ(rebin(var, Dim::Y, oldEdges, newEdges), expected);
+}
+
+TEST_F(RebinnerTest, inner) {
+  const Rebinner rebinner(Dim::Y, oldEdges, newEdges);
+  const auto transposed = copy(transpose(var));
+  EXPECT_EQ(rebinner(transposed), copy(transpose(expected)));
+  // Non-contiguous input.
+  EXPECT_EQ(rebinner(transpose(var)), transpose(expected));
+}
+
+TEST_F(RebinnerTest, apply_repeatedly) {
+  const Rebinner rebinner(Dim::Y, oldEdges, newEdges);
+  EXPECT_EQ(rebinner(var), expected);
+  EXPECT_EQ(rebinner(var.slice({Dim::X, 1})), expected.slice({Dim::X, 1}));
+  EXPECT_EQ(rebinner(astype(var.slice({Dim::X, 0}), dtype<float>)),
+            astype(expected.slice({Dim::X, 0}), dtype<float>));
+}
+
+TEST_F(RebinnerTest, descending) {
+  const Rebinner rebinner(
+      Dim::Y,
+      makeVariable<double>(Dims{Dim::Y}, Shape{5}, Values{4, 3, 2, 1, 0}),
+      makeVariable<double>(Dims{Dim::Y}, Shape{3}, Values{4.5, 2.0, 0.5}));
+  EXPECT_EQ(rebinner(makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{4, 2},
+                                          units::counts,
+                                          Values{7, 8, 5, 6, 3, 4, 1, 2},
+                                          Variances{4, 4, 3, 3, 2, 2, 1, 1})),
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                 units::counts, Values{12.0, 14.0, 3.5, 5.0},
+                                 Variances{7.0, 7.0, 2.5, 2.5}));
+}
+
+TEST_F(RebinnerTest, many_spectra) {
+  // Inner extent larger than the block size used by the sparse product.
+  const scipp::index nx = 1000;
+  std::vector<double> values;
+  std::vector<double> expected_values;
+  for (const double y : {1.0, 2.0, 3.0, 4.0})
+    for (scipp::index x = 0; x < nx; ++x)
+      values.push_back(y * static_cast<double>(x + 1));
+  // New bins cover half of old bin 0 and all of 1, and all of 2 and 3.
+  for (const double y : {0.5 * 1.0 + 2.0, 3.0 + 4.0})
+    for (scipp::index x = 0; x < nx; ++x)
+      expected_values.push_back(y * static_cast<double>(x + 1));
+  const auto rebinned = Rebinner(Dim::Y, oldEdges, newEdges)(
+      makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{4, nx}, units::counts,
+                           Values(values)));
+  EXPECT_EQ(rebinned,
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, nx},
+                                 units::counts, Values(expected_values)));
+}
+
+TEST_F(RebinnerTest, matches_element_rebin_with_random_edges) {
+  std::mt19937 rng(4321);
+  std::uniform_real_distribution<double> width(0.1, 1.0);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  const auto make_edges = [&](const scipp::index size, const double start) {
+    std::vector<double> edges{start};
+    while (scipp::size(edges) < size)
+      edges.push_back(edges.back() + width(rng));
+    return edges;
+  };
+  for (const scipp::index nx : {1, 3, 300}) {
+    // New edges extend beyond the old edges on both sides.
+    const auto old_edges = make_edges(57, 0.0);
+    const auto new_edges = make_edges(23, -1.0);
+    const auto nold = scipp::size(old_edges) - 1;
+    const auto nnew = scipp::size(new_edges) - 1;
+    std::vector<double> values(nold * nx);
+    std::vector<double> variances(nold * nx);
+    for (scipp::index i = 0; i < nold * nx; ++i) {
+      values[i] = value(rng);
+      variances[i] = std::abs(value(rng));
+    }
+    const auto rebinned = Rebinner(
+        Dim::Y,
+        makeVariable<double>(Dims{Dim::Y}, Shape{nold + 1}, Values(old_edges)),
+        makeVariable<double>(Dims{Dim::Y}, Shape{nnew + 1},
+                             Values(new_edges)))(makeVariable<double>(
+        Dims{Dim::Y, Dim::X}, Shape{nold, nx}, Values(values),
+        Variances(variances)));
+    const auto result_values = rebinned.values<double>();
+    const auto result_variances = rebinned.variances<double>();
+    for (scipp::index x = 0; x < nx; ++x) {
+      std::vector<double> in_values(nold);
+      std::vector<double> in_variances(nold);
+      for (scipp::index i = 0; i < nold; ++i) {
+        in_values[i] = values[i * nx + x];
+        in_variances[i] = variances[i * nx + x];
+      }
+      std::vector<double> out_values(nnew);
+      std::vector<double> out_variances(nnew);
+      core::element::rebin<std::less<>>(
+          core::ValueAndVariance(std::span(out_values),
+                                 std::span(out_variances)),
+          std::span<const double>(new_edges),
+          core::ValueAndVariance(std::span<const double>(in_values),
+                                 std::span<const double>(in_variances)),
+          std::span<const double>(old_edges));
+      for (scipp::index i = 0; i < nnew; ++i) {
+        EXPECT_NEAR(result_values[i * nx + x], out_values[i], 1e-12);
+        EXPECT_NEAR(result_variances[i * nx + x], out_variances[i], 1e-12);
+      }
+    }
+  }
+}
+
+TEST_F(RebinnerTest, bad_edges) {
+  EXPECT_THROW(Rebinner(Dim::Y, astype(oldEdges, dtype<float>), newEdges),
+               except::TypeError);
+  auto edges_m = copy(oldEdges);
+  edges_m.setUnit(units::m);
+  EXPECT_THROW(Rebinner(Dim::Y, edges_m, newEdges), except::UnitError);
+  EXPECT_THROW(Rebinner(Dim::Y,
+                        makeVariable<double>(Dims{Dim::Y}, Shape{3},
+                                             Values{0, 2, 1}),
+                        newEdges),
+               except::BinEdgeError);
+  const auto edges_2d =
+      broadcast(oldEdges, Dimensions{{Dim::X, 2}, {Dim::Y, 5}});
+  EXPECT_THROW(Rebinner(Dim::Y, edges_2d, newEdges), except::DimensionError);
+}
+
+TEST_F(RebinnerTest, bad_input) {
+  const Rebinner rebinner(Dim::Y, oldEdges, newEdges);
+  EXPECT_THROW_DISCARD(rebinner(var.slice({Dim::Y, 0, 3})),
+                       except::BinEdgeError);
+  EXPECT_THROW_DISCARD(
+      rebinner(makeVariable<bool>(Dims{Dim::Y}, Shape{4},
+                                  Values{true, false, true, false})),
+      except::TypeError);
+}
+
+TEST(ResampleTest, mean_descending) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{4}, units::K,
+                                        Values{4, 3, 2, 1});
+  const auto oldEdges =
+      makeVariable<double>(Dims{Dim::X}, Shape{5}, Values{4, 3, 2, 1, 0});
+  const auto newEdges =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{4.0, 1.0, 0.0});
+  EXPECT_EQ(resample(var, Dim::X, oldEdges, newEdges, ResampleMode::Mean),
+            makeVariable<double>(Dims{Dim::X}, Shape{2}, units::K,
+                                 Values{3.0, 1.0}));
+}
+
+TEST(ResampleTest, min_without_overlap) {
+  const auto var = makeVariable<int64_t>(Dims{Dim::X}, Shape{3}, units::K,
+                                         Values{5, 2, 7});
+  const auto oldEdges =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{0, 1, 2, 3});
+  const auto newEdges =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{0.5, 3.0, 4.0});
+  EXPECT_EQ(resample(var, Dim::X, oldEdges, newEdges, ResampleMode::Min),
+            makeVariable<int64_t>(
+                Dims{Dim::X}, Shape{2}, units::K,
+                Values{int64_t{2}, std::numeric_limits<int64_t>::max()}));
+}
+
+TEST(ResampleTest, ragged_edges) {
+  const auto var = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 2},
+                                        Values{1, 3, 1, 3});
+  const auto oldEdges = makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 3},
+                                             Values{0, 1, 2, 0, 1, 3});
+  const auto newEdges =
+      makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{0, 2});
+  EXPECT_EQ(resample(var, Dim::X, oldEdges, newEdges, ResampleMode::Mean),
+            makeVariable<double>(Dims{Dim::Y, Dim::X}, Shape{2, 1},
+                                 Values{2.0, 2.0}));
+}
+
+TEST(ResampleTest, fail_edges_with_different_unit) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{1, 2});
+  const auto oldEdges = makeVariable<double>(Dims{Dim::X}, Shape{3},
+                                             units::m, Values{0, 1, 2});
+  const auto newEdges =
+      makeVariable<double>(Dims{Dim::X}, Shape{2}, units::s, Values{0, 2});
+  EXPECT_THROW_DISCARD(
+      resample(var, Dim::X, oldEdges, newEdges, ResampleMode::Max),
+      except::UnitError);
+}
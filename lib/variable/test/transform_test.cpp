@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
 #include <gtest/gtest.h>
+#include <utility>
 #include <vector>
 
 #include "test_macros.h"
@@ -8,7 +9,11 @@
 
 #include "scipp/core/eigen.h"
 #include "scipp/core/element/arg_list.h"
+#include "scipp/core/parallel.h"
+#include "scipp/core/profiler.h"
+#include "scipp/core/simd.h"
 
+#include "scipp/variable/accumulate.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/bins.h"
 #include "scipp/variable/transform.h"
@@ -130,6 +135,73 @@ TEST(TransformTest, user_op_with_variances) {
   EXPECT_EQ(result, var);
 }
 
+class TransformSimdTest : public ::testing::TestWithParam<simd::Level> {
+protected:
+  TransformSimdTest() { simd::set_max_level(GetParam()); }
+  ~TransformSimdTest() override { simd::set_max_level(simd::Level::AVX512); }
+  // Length is not a multiple of the pack size, to cover the remainder loop.
+  static constexpr scipp::index size = 37;
+  static Variable make(const double offset) {
+    auto var = makeVariable<double>(Dims{Dim::X}, Shape{size}, Values{},
+                                    Variances{});
+    for (scipp::index i = 0; i < size; ++i) {
+      var.values<double>()[i] = offset + 0.5 * i;
+      var.variances<double>()[i] = 0.1 * i;
+    }
+    return var;
+  }
+  static Variable expected(const Variable &a, const Variable &b) {
+    auto out = copy(a);
+    for (scipp::index i = 0; i < size; ++i) {
+      const auto j = b.dims().volume() == 1 ? 0 : i;
+      const ValueAndVariance x{a.values<double>()[i], a.variances<double>()[i]};
+      const ValueAndVariance y{b.values<double>()[j], b.variances<double>()[j]};
+      const auto result = x * y + y;
+      out.values<double>()[i] = result.value;
+      out.variances<double>()[i] = result.variance;
+    }
+    return out;
+  }
+  Variable a = make(1.0);
+  Variable b = make(2.0);
+  Variable scalar = makeVariable<double>(Values{3.0}, Variances{0.2});
+};
+
+INSTANTIATE_TEST_SUITE_P(Levels, TransformSimdTest,
+                         ::testing::Values(simd::Level::Default,
+                                           simd::Level::AVX2,
+                                           simd::Level::AVX512));
+
+TEST_P(TransformSimdTest, binary_with_variances) {
+  const auto op = [](const auto &x, const auto &y) { return x * y + y; };
+  EXPECT_EQ(transform<pair_self_t<double>>(a, b, op, name), expected(a, b));
+  EXPECT_EQ(transform<pair_self_t<double>>(a, scalar, op, name),
+            expected(a, scalar));
+}
+
+TEST_P(TransformSimdTest, binary_in_place_with_variances) {
+  const auto op = [](auto &x, const auto &y) { x = x * y + y; };
+  auto result = copy(a);
+  transform_in_place<pair_self_t<double>>(result, b, op, name);
+  EXPECT_EQ(result, expected(a, b));
+  result = copy(a);
+  transform_in_place<pair_self_t<double>>(result, scalar, op, name);
+  EXPECT_EQ(result, expected(a, scalar));
+}
+
+TEST_P(TransformSimdTest, accumulate_is_not_vectorized) {
+  // Output has stride 0 so elements must be processed in order.
+  auto sum = makeVariable<double>(Values{0.0}, Variances{0.0});
+  accumulate_in_place<pair_self_t<double>>(
+      sum, a, [](auto &x, const auto &y) { x = x * 0.5 + y; }, name);
+  ValueAndVariance expected{0.0, 0.0};
+  for (scipp::index i = 0; i < size; ++i)
+    expected = expected * 0.5 + ValueAndVariance{a.values<double>()[i],
+                                                 a.variances<double>()[i]};
+  EXPECT_EQ(sum.value<double>(), expected.value);
+  EXPECT_EQ(sum.variance<double>(), expected.variance);
+}
+
 class TransformInPlaceDryRunTest : public ::testing::Test {
 protected:
   static constexpr auto unary{[](auto &x) { x *= x; }};
@@ -454,3 +526,234 @@ TEST_F(TransformBinElementsTest, single_arg_in_place) {
   Variable expected = make_bins(indices, Dim::X, buffer * buffer);
   EXPECT_EQ(var, expected);
 }
+
+class TransformUnevenBinsTest : public ::testing::Test {
+protected:
+  TransformUnevenBinsTest() {
+    // More threads than cores is fine, ensures work is actually split.
+    core::parallel::set_max_threads(8);
+    std::vector<std::pair<scipp::index, scipp::index>> ranges;
+    scipp::index begin = 0;
+    for (const scipp::index size : {1, 200000, 0, 3, 50000, 2}) {
+      ranges.emplace_back(begin, begin + size);
+      begin += size;
+    }
+    indices = makeVariable<std::pair<scipp::index, scipp::index>>(
+        Dims{Dim::Y}, Shape{ranges.size()},
+        Values(ranges.begin(), ranges.end()));
+    std::vector<double> values(begin);
+    for (scipp::index i = 0; i < begin; ++i)
+      values[i] = static_cast<double>(i % 1000);
+    buffer = makeVariable<double>(Dims{Dim::X}, Shape{begin},
+                                  Values(values.begin(), values.end()));
+    scale = makeVariable<double>(Dims{Dim::Y}, Shape{ranges.size()},
+                                 Values{1, 2, 3, 4, 5, 6});
+  }
+  ~TransformUnevenBinsTest() override { core::parallel::reset_max_threads(); }
+
+  Variable expected_scaled() const {
+    auto expected = copy(buffer);
+    const auto ranges = indices.values<std::pair<scipp::index, scipp::index>>();
+    const auto factors = scale.values<double>();
+    auto out = expected.values<double>();
+    for (scipp::index bin = 0; bin < scipp::size(ranges); ++bin)
+      for (auto i = ranges[bin].first; i < ranges[bin].second; ++i)
+        out[i] *= factors[bin];
+    return make_bins(indices, Dim::X, expected);
+  }
+
+  Variable indices;
+  Variable buffer;
+  Variable scale;
+};
+
+TEST_F(TransformUnevenBinsTest, binary) {
+  const auto var = make_bins(indices, Dim::X, copy(buffer));
+  EXPECT_EQ(var * scale, expected_scaled());
+  EXPECT_EQ(scale * var, expected_scaled());
+}
+
+TEST_F(TransformUnevenBinsTest, binary_in_place) {
+  auto var = make_bins(indices, Dim::X, copy(buffer));
+  var *= scale;
+  EXPECT_EQ(var, expected_scaled());
+}
+
+TEST_F(TransformUnevenBinsTest, unary) {
+  const auto var = make_bins(indices, Dim::X, copy(buffer));
+  const auto out = transform<double>(
+      var, overloaded{core::element::arg_list<double>,
+                      [](const units::Unit &u) { return u; },
+                      [](const auto &x) { return x; }},
+      name);
+  EXPECT_EQ(out, var);
+}
+
+TEST_F(TransformUnevenBinsTest, accumulate_to_dense) {
+  const auto var = make_bins(indices, Dim::X, copy(buffer));
+  auto sums = makeVariable<double>(Dims{Dim::Y}, Shape{6});
+  accumulate_in_place<double>(
+      sums, var,
+      overloaded{core::element::arg_list<double>,
+                 [](const units::Unit &, const units::Unit &) {},
+                 [](auto &a, const auto &b) { a += b; }},
+      name);
+  const auto ranges = indices.values<std::pair<scipp::index, scipp::index>>();
+  const auto values = buffer.values<double>();
+  for (scipp::index bin = 0; bin < 6; ++bin) {
+    double sum = 0.0;
+    for (auto i = ranges[bin].first; i < ranges[bin].second; ++i)
+      sum += values[i];
+    EXPECT_EQ(sums.values<double>()[bin], sum);
+  }
+}
+
+TEST(TransformProfilerTest, records_named_operations) {
+  const auto a =
+      makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4});
+  const auto b = makeVariable<double>(Dims{Dim::Y}, Shape{2}, Values{1, 2});
+  core::profiler::reset();
+  core::profiler::set_enabled(true);
+  const auto out = transform<double>(
+      a, b, [](const auto x, const auto y) { return x + y; }, "profiled_add");
+  core::profiler::set_enabled(false);
+  const auto stats = core::profiler::stats();
+  core::profiler::reset();
+  ASSERT_EQ(stats.size(), 1);
+  EXPECT_EQ(stats[0].name, "profiled_add");
+  EXPECT_EQ(stats[0].calls, 1);
+  EXPECT_EQ(stats[0].elements, out.dims().volume());
+  EXPECT_EQ(stats[0].bytes_written, out.dims().volume() * sizeof(double));
+  EXPECT_EQ(stats[0].bytes_read, 2 * out.dims().volume() * sizeof(double));
+  EXPECT_GT(stats[0].vectorized_chunks + stats[0].specialized_chunks +
+                stats[0].generic_chunks,
+            0);
+}
+
+TEST(TransformProfilerTest, disabled_records_nothing) {
+  auto a = makeVariable<double>(Dims{Dim::X}, Shape{4}, Values{1, 2, 3, 4});
+  core::profiler::reset();
+  transform_in_place<double>(
+      a,
+      overloaded{[](units::Unit &) {}, [](auto &x) { x *= 2.0; }},
+      "profiled_scale");
+  EXPECT_TRUE(core::profiler::stats().empty());
+}
+
+TEST(TransformScalarTest, binary) {
+  const auto a = makeVariable<double>(Values{1.5}, units::m);
+  const auto b = makeVariable<double>(Values{2.0}, units::s);
+  EXPECT_EQ(a * b, makeVariable<double>(Values{3.0}, units::m * units::s));
+  EXPECT_EQ(a + a, makeVariable<double>(Values{3.0}, units::m));
+  EXPECT_THROW_DISCARD(a + b, except::UnitError);
+}
+
+TEST(TransformScalarTest, binary_mixed_dtype) {
+  const auto a = makeVariable<double>(Values{1.5}, units::m);
+  const auto b = makeVariable<int64_t>(Values{2});
+  EXPECT_EQ(a * b, makeVariable<double>(Values{3.0}, units::m));
+}
+
+TEST(TransformScalarTest, binary_with_variances) {
+  const auto a = makeVariable<double>(Values{1.5}, units::m);
+  const auto b = makeVariable<double>(Values{2.0}, Variances{1.0});
+  EXPECT_EQ(a * b,
+            makeVariable<double>(Values{3.0}, Variances{2.25}, units::m));
+}
+
+TEST(TransformScalarTest, binary_slice) {
+  const auto a = makeVariable<float>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  EXPECT_EQ(a.slice({Dim::X, 2}) - a.slice({Dim::X, 0}),
+            makeVariable<float>(Values{2}));
+}
+
+TEST(TransformScalarTest, in_place) {
+  auto a = makeVariable<double>(Values{1.5}, units::m);
+  const auto b = makeVariable<double>(Values{2.0}, units::s);
+  a *= b;
+  EXPECT_EQ(a, makeVariable<double>(Values{3.0}, units::m * units::s));
+  EXPECT_THROW(a += b, except::UnitError);
+  EXPECT_EQ(a, makeVariable<double>(Values{3.0}, units::m * units::s));
+  auto readonly = a.as_const();
+  EXPECT_THROW(readonly *= b, except::VariableError);
+}
+
+TEST(TransformScalarTest, in_place_slice) {
+  auto a = makeVariable<int64_t>(Dims{Dim::X}, Shape{2}, Values{1, 2});
+  a.slice({Dim::X, 1}) += makeVariable<int64_t>(Values{3});
+  EXPECT_EQ(a, makeVariable<int64_t>(Dims{Dim::X}, Shape{2}, Values{1, 5}));
+}
+
+namespace {
+const double *data_ptr(const Variable &var) {
+  return var.values<double>().data();
+}
+} // namespace
+
+TEST(TransformReuseBufferTest, temporary_first_operand) {
+  auto a = makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m,
+                                Values{1, 2, 3}, Variances{1, 2, 3});
+  const auto b = makeVariable<double>(Dims{Dim::X}, Shape{3}, units::s,
+                                      Values{2, 2, 2});
+  const auto expected = a / b;
+  const auto *buffer = data_ptr(a);
+  const auto out = std::move(a) / b;
+  EXPECT_EQ(out, expected);
+  EXPECT_EQ(data_ptr(out), buffer);
+}
+
+TEST(TransformReuseBufferTest, temporary_second_operand) {
+  const auto a = makeVariable<float>(Dims{Dim::Y}, Shape{2}, Values{1, 2});
+  auto b = makeVariable<float>(Dims{Dim::X, Dim::Y}, Shape{2, 2},
+                               Values{1, 2, 3, 4});
+  const auto *buffer = b.values<float>().data();
+  const auto out = a - std::move(b);
+  EXPECT_EQ(out, makeVariable<float>(Dims{Dim::X, Dim::Y}, Shape{2, 2},
+                                     Values{0, 0, -2, -2}));
+  EXPECT_EQ(std::as_const(out).values<float>().data(), buffer);
+}
+
+TEST(TransformReuseBufferTest, chained_expression_reuses_temporaries) {
+  const auto a = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{5, 7});
+  const auto b = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{1, 1});
+  const auto c = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{2, 3});
+  auto diff = a - b;
+  const auto *buffer = data_ptr(diff);
+  const auto out = std::move(diff) / c;
+  EXPECT_EQ(out, makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{2, 2}));
+  EXPECT_EQ(data_ptr(out), buffer);
+}
+
+TEST(TransformReuseBufferTest, shared_temporary_is_not_modified) {
+  auto a = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{1, 2});
+  const Variable shallow(a);
+  const auto out = std::move(a) + shallow;
+  EXPECT_EQ(out, makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{2, 4}));
+  EXPECT_EQ(shallow,
+            makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{1, 2}));
+  EXPECT_NE(data_ptr(out), data_ptr(shallow));
+}
+
+TEST(TransformReuseBufferTest, mismatching_temporary_is_not_reused) {
+  const auto xy = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{2, 2},
+                                       Values{1, 2, 3, 4});
+  auto x = makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{1, 2});
+  const auto *buffer = data_ptr(x);
+  const auto broadcast = std::move(x) * xy;
+  EXPECT_EQ(broadcast, makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{2, 2},
+                                            Values{1, 2, 6, 8}));
+  EXPECT_NE(data_ptr(broadcast), buffer);
+
+  auto i = makeVariable<int64_t>(Dims{Dim::X}, Shape{2}, Values{1, 2});
+  EXPECT_EQ(std::move(i) * makeVariable<double>(Values{0.5}),
+            makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{0.5, 1.0}));
+
+  auto no_variances =
+      makeVariable<double>(Dims{Dim::X}, Shape{2}, Values{1, 2});
+  const auto with_variances = makeVariable<double>(
+      Dims{Dim::X}, Shape{2}, Values{1, 1}, Variances{1, 1});
+  const auto *values_buffer = data_ptr(no_variances);
+  const auto out = std::move(no_variances) * with_variances;
+  EXPECT_TRUE(out.hasVariances());
+  EXPECT_NE(data_ptr(out), values_buffer);
+}
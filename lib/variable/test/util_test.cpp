@@ -6,6 +6,7 @@
 #include "scipp/units/unit.h"
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/reduction.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/util.h"
 
 #include "test_macros.h"
@@ -150,6 +151,102 @@ TEST(UtilTest, allsorted_multidimensional) {
   EXPECT_TRUE(allsorted(var, Dim::X, SortOrder::Descending));
 }
 
+TEST(UtilTest, alllinspace) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  EXPECT_TRUE(alllinspace(var, Dim::X));
+  EXPECT_FALSE(alllinspace(var.slice({Dim::X, 0, 1}), Dim::X));
+  var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 4});
+  EXPECT_FALSE(alllinspace(var, Dim::X));
+  var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{3, 2, 1});
+  EXPECT_FALSE(alllinspace(var, Dim::X));
+}
+
+TEST(UtilTest, edge_properties) {
+  const auto var =
+      makeVariable<int64_t>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  const auto properties = edge_properties(var, Dim::X);
+  EXPECT_TRUE(properties.ascending);
+  EXPECT_FALSE(properties.descending);
+  EXPECT_TRUE(properties.linspace);
+}
+
+TEST(UtilTest, edge_properties_outer_dim) {
+  const auto var = makeVariable<double>(Dims{Dim::X, Dim::Y}, Shape{3, 2},
+                                        Values{1, 1, 2, 3, 3, 5});
+  const auto x = edge_properties(var, Dim::X);
+  EXPECT_TRUE(x.ascending);
+  EXPECT_TRUE(x.linspace);
+  const auto y = edge_properties(var, Dim::Y);
+  EXPECT_TRUE(y.ascending);
+  EXPECT_FALSE(y.linspace);
+}
+
+TEST(UtilTest, edge_properties_invalidated_by_write) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  EXPECT_TRUE(alllinspace(var, Dim::X));
+  var.values<double>()[2] = 4.0;
+  EXPECT_FALSE(alllinspace(var, Dim::X));
+  EXPECT_TRUE(allsorted(var, Dim::X));
+  var.values<double>()[0] = 5.0;
+  EXPECT_FALSE(allsorted(var, Dim::X));
+}
+
+TEST(UtilTest, edge_properties_not_stale_after_write_through_earlier_view) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  // Views obtained for writing before the properties are computed.
+  auto values = var.values<double>();
+  auto slice = var.slice({Dim::X, 0});
+  EXPECT_TRUE(alllinspace(var, Dim::X));
+  values[2] = 4.0;
+  EXPECT_FALSE(alllinspace(var, Dim::X));
+  EXPECT_TRUE(allsorted(var, Dim::X));
+  slice.value<double>() = 5.0;
+  EXPECT_FALSE(allsorted(var, Dim::X));
+}
+
+TEST(UtilTest, edge_properties_not_stale_after_transform_through_slice) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  auto slice = var.slice({Dim::X, 2, 3});
+  EXPECT_TRUE(alllinspace(var, Dim::X));
+  slice += 1.0 * units::one;
+  EXPECT_FALSE(alllinspace(var, Dim::X));
+  EXPECT_TRUE(allsorted(var, Dim::X));
+}
+
+TEST(UtilTest, edge_properties_of_copy) {
+  const auto var =
+      makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  EXPECT_TRUE(alllinspace(var, Dim::X));
+  auto copied = copy(var);
+  EXPECT_TRUE(alllinspace(copied, Dim::X));
+  copied.values<double>()[2] = 4.0;
+  EXPECT_FALSE(alllinspace(copied, Dim::X));
+  EXPECT_TRUE(alllinspace(var, Dim::X));
+}
+
+TEST(UtilTest, edge_properties_cached_unless_pinned) {
+  auto var = makeVariable<double>(Dims{Dim::X}, Shape{3}, Values{1, 2, 3});
+  EXPECT_TRUE(var.data().can_cache_edge_properties());
+  // Read-only references, e.g., from numpy, do not prevent caching.
+  var.data_handle()->reference_buffers();
+  EXPECT_TRUE(var.data().can_cache_edge_properties());
+  var.data_handle()->pin_buffers();
+  EXPECT_FALSE(var.data().can_cache_edge_properties());
+  EXPECT_TRUE(alllinspace(var, Dim::X));
+  EXPECT_TRUE(allsorted(var, Dim::X));
+  EXPECT_FALSE(allsorted(var, Dim::X, SortOrder::Descending));
+}
+
+TEST(UtilTest, edge_properties_depend_on_shape) {
+  const auto var = makeVariable<double>(Dims{Dim::X}, Shape{6},
+                                        Values{1, 2, 3, 5, 6, 7});
+  EXPECT_FALSE(alllinspace(var, Dim::X));
+  // Shares the array of values with `var`.
+  const auto folded = fold(var, Dim::X, {{Dim::Y, 2}, {Dim::X, 3}});
+  EXPECT_TRUE(alllinspace(folded, Dim::X));
+  EXPECT_FALSE(alllinspace(var, Dim::X));
+}
+
 TEST(VariableTest, where) {
   auto var =
       makeVariable<double>(Dims{Dim::X}, Shape{3}, units::m, Values{1, 2, 3});
@@ -9,6 +9,7 @@
 #include "scipp/variable/arithmetic.h"
 #include "scipp/variable/astype.h"
 #include "scipp/variable/reduction.h"
+#include "scipp/variable/shape.h"
 #include "scipp/variable/subspan_view.h"
 #include "scipp/variable/transform.h"
 
@@ -70,14 +71,87 @@ Variable issorted(const Variable &x, const Dim dim, const SortOrder order) {
   return out;
 }
 
+namespace {
+/// Return true if `x` covers the full array of its model in default order and
+/// the model supports caching, such that properties of its values can be cached
+/// with the array. Otherwise only the requested property should be computed.
+bool can_cache_properties(const Variable &x) {
+  return !x.is_slice() && Strides(x.strides()) == Strides(x.dims()) &&
+         x.data().can_cache_edge_properties();
+}
+
+Variable as_contiguous(const Variable &var, const Dim dim) {
+  if (var.stride(dim) == 1)
+    return var;
+  auto dims = var.dims();
+  dims.erase(dim);
+  dims.addInner(dim, var.dims()[dim]);
+  return copy(transpose(var, dims.labels()));
+}
+
+bool supports_linspace(const DType type) {
+  return type == dtype<double> || type == dtype<float> ||
+         type == dtype<int64_t> || type == dtype<int32_t> ||
+         type == dtype<time_point>;
+}
+} // namespace
+
 /// Return true if variable values are sorted along given dim.
 ///
 /// If `order` is SortOrder::Ascending, checks if values are non-decreasing.
 /// If `order` is SortOrder::Descending, checks if values are non-increasing.
 bool allsorted(const Variable &x, const Dim dim, const SortOrder order) {
+  if (can_cache_properties(x)) {
+    const auto properties = edge_properties(x, dim);
+    return order == SortOrder::Ascending ? properties.ascending
+                                         : properties.descending;
+  }
   return variable::all(issorted(x, dim, order)).value<bool>();
 }
 
+/// Return true if variable values are linearly spaced along given dim.
+bool alllinspace(const Variable &x, const Dim dim) {
+  if (can_cache_properties(x))
+    return edge_properties(x, dim).linspace;
+  return variable::all(islinspace(x, dim)).value<bool>();
+}
+
+/// Return sortedness and linear or logarithmic spacing of variable values along
+/// given dim.
+///
+/// Bin edges are typically used many times without modification, so the result
+/// is cached with the array of values, if possible. The cache is invalidated by
+/// any write access to the values. Arrays that views for writing may still
+/// refer to, e.g., from `Variable::values`, are pinned and never cached.
+/// Callers that need a single property should use `allsorted` or `alllinspace`,
+/// which compute only that property if the result cannot be cached.
+EdgeProperties edge_properties(const Variable &x, const Dim dim) {
+  const bool cache = can_cache_properties(x);
+  if (cache)
+    if (const auto cached = x.data().cached_edge_properties(x.dims(), dim))
+      return *cached;
+  EdgeProperties properties;
+  properties.ascending =
+      variable::all(issorted(x, dim, SortOrder::Ascending)).value<bool>();
+  properties.descending =
+      variable::all(issorted(x, dim, SortOrder::Descending)).value<bool>();
+  if (properties.ascending) {
+    // The spacing is checked on subspans, which require stride 1.
+    const auto edges = as_contiguous(x, dim);
+    properties.linspace = supports_linspace(x.dtype()) &&
+                          variable::all(islinspace(edges, dim)).value<bool>();
+    properties.logspace =
+        !properties.linspace &&
+        (x.dtype() == dtype<double> || x.dtype() == dtype<float>) &&
+        variable::all(transform(subspan_view(edges, dim),
+                                core::element::islogspace, "islogspace"))
+            .value<bool>();
+  }
+  if (cache)
+    x.data().cache_edge_properties(x.dims(), dim, properties);
+  return properties;
+}
+
 /// Zip elements of two variables into a variable where each element is a pair.
 Variable zip(const Variable &first, const Variable &second) {
   return transform(first, second, core::element::zip, "zip");
@@ -282,6 +282,17 @@ Variable Variable::as_const() const {
   return out;
 }
 
+core::MemoryUsage Variable::memory_usage() const {
+  BufferSet seen;
+  return variable::memory_usage(*this, seen);
+}
+
+core::MemoryUsage memory_usage(const Variable &var, BufferSet &seen) {
+  if (!var.is_valid())
+    return {};
+  return var.data().memory_usage(seen);
+}
+
 void Variable::expectWritable() const {
   if (m_readonly)
     throw except::VariableError("Read-only flag is set, cannot mutate data.");
@@ -5,4 +5,18 @@ namespace scipp::variable {
 
 VariableConcept::VariableConcept(const units::Unit &unit) : m_unit(unit) {}
 
+namespace {
+thread_local scipp::index transient_write_depth = 0;
+}
+
+namespace detail {
+TransientWriteScope::TransientWriteScope() noexcept {
+  ++transient_write_depth;
+}
+TransientWriteScope::~TransientWriteScope() { --transient_write_depth; }
+bool TransientWriteScope::active() noexcept {
+  return transient_write_depth > 0;
+}
+} // namespace detail
+
 } // namespace scipp::variable
@@ -28,7 +28,7 @@ del runtime_config
 
 from .core import __version__
 # Import classes
-from .core import Variable, DataArray, Dataset, Unit
+from .core import Variable, DataArray, Dataset, HistogramAccumulator, Unit
 # Import errors
 from .core import BinEdgeError, BinnedDataError, CoordError, \
                          DataArrayError, DatasetError, DimensionError, \
@@ -76,12 +76,15 @@ from .core import cumsum
 from .core import combine_masks, merge
 from .core import groupby
 from .core import abs, nan_to_num, norm, reciprocal, pow, sqrt, exp, log, log10, round, floor, ceil, erf, erfc
-from .core import dot, islinspace, issorted, allsorted, cross, sort, values, variances, stddevs, rebin, where
+from .core import dot, islinspace, issorted, allsorted, cross, sort, values, variances, stddevs, rebin, resample, where
 from .core import mean, nanmean, sum, nansum, min, max, nanmin, nanmax, all, any
 from .core import broadcast, concat, concatenate, fold, flatten, transpose
 from .core import sin, cos, tan, asin, acos, atan, atan2
 from .core import isnan, isinf, isfinite, isposinf, isneginf, to_unit
-from .core import scalar, zeros, zeros_like, ones, ones_like, empty, empty_like, full, full_like, matrix, matrices, vector, vectors, array, linspace, geomspace, logspace, arange
+from .core import get_num_threads, set_num_threads, num_threads
+from .core import memory_stats, memory_usage, reset_peak_memory
+from .core import enable_profiling, reset_profiling, profiling_stats, profiling_summary, save_chrome_trace, profile
+from .core import scalar, zeros, zeros_like, ones, ones_like, empty, empty_like, map_file, full, full_like, matrix, matrices, vector, vectors, array, linspace, geomspace, logspace, arange
 
 # Mainly imported for docs
 from .core import Bins, GroupByDataset, GroupByDataArray
@@ -17,7 +17,7 @@ if _debug_:
 
 from .._scipp import __version__
 from .._scipp.core import Variable, DataArray, Dataset, GroupByDataArray, \
-                         GroupByDataset, Unit
+                         GroupByDataset, HistogramAccumulator, Unit
 # Import errors
 from .._scipp.core import BinEdgeError, BinnedDataError, CoordError, \
                          DataArrayError, DatasetError, DimensionError, \
@@ -73,9 +73,12 @@ from .cumulative import cumsum
 from .dataset import combine_masks, merge
 from .groupby import groupby
 from .math import abs, nan_to_num, norm, reciprocal, pow, sqrt, exp, log, log10, round, floor, ceil, erf, erfc
-from .operations import dot, islinspace, issorted, allsorted, cross, sort, values, variances, stddevs, rebin, where
+from .memory import memory_stats, memory_usage, reset_peak_memory
+from .parallel import get_num_threads, set_num_threads, num_threads
+from .profiler import enable_profiling, reset_profiling, profiling_stats, profiling_summary, save_chrome_trace, profile
+from .operations import dot, islinspace, issorted, allsorted, cross, sort, values, variances, stddevs, rebin, resample, where
 from .reduction import mean, nanmean, sum, nansum, min, max, nanmin, nanmax, all, any
 from .shape import broadcast, concat, concatenate, fold, flatten, transpose
 from .trigonometry import sin, cos, tan, asin, acos, atan, atan2
 from .unary import isnan, isinf, isfinite, isposinf, isneginf, to_unit
-from .variable import scalar, zeros, zeros_like, ones, ones_like, empty, empty_like, full, full_like, matrix, matrices, vector, vectors, array, linspace, geomspace, logspace, arange
+from .variable import scalar, zeros, zeros_like, ones, ones_like, empty, empty_like, map_file, full, full_like, matrix, matrices, vector, vectors, array, linspace, geomspace, logspace, arange
@@ -155,6 +155,18 @@ class Bins:
                 out = _call_cpp_func(_cpp.buckets.concatenate, self._obj, other)
             return out
 
+    def reserve(self, capacity: _cpp.Variable) -> None:
+        """Reserve space for at least `capacity` events in every bin.
+
+        Subsequent calls to :py:meth:`concatenate` with `out` set to the input
+        can then add events without reallocating the buffer. A copy of the
+        input drops the reserved space again.
+
+        :param capacity: Minimum number of events per bin, broadcast to the
+                         shape of the input.
+        """
+        _call_cpp_func(_cpp.buckets.reserve, self._obj, capacity)
+
 
 class GroupbyBins:
     """
@@ -207,11 +219,17 @@ def _groupby_bins(obj):
     return GroupbyBins(obj)
 
 
-def histogram(x: Union[_cpp.DataArray, _cpp.Dataset], *,
-              bins: _cpp.Variable) -> Union[_cpp.DataArray, _cpp.Dataset]:
+def histogram(
+    x: Union[_cpp.DataArray, _cpp.Dataset], *,
+    bins: Union[_cpp.Variable, Sequence[_cpp.Variable]]
+) -> Union[_cpp.DataArray, _cpp.Dataset]:
     """Create dense data by histogramming data along all dimension given by
     edges.
 
+    If ``bins`` is a sequence of bin edges a table of events is histogrammed
+    along all of their dimensions in a single pass, without creating binned
+    data as an intermediate result.
+
     :return: DataArray / Dataset with values equal to the sum
              of values in each given bin.
     :seealso: :py:func:`scipp.bin` for binning data.
@@ -0,0 +1,58 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+
+from typing import Dict, Union
+
+from .._scipp import core as _cpp
+from ..typing import VariableLike
+
+
+def memory_stats() -> Dict[str, Union[int, Dict[str, int]]]:
+    """Return statistics of memory held by the array buffers of scipp objects.
+
+    The returned dict contains:
+
+    - ``current_bytes``: Bytes currently held by array buffers.
+    - ``peak_bytes``: Maximum of ``current_bytes`` since start or the last
+      call to :py:func:`scipp.reset_peak_memory`.
+    - ``allocations``: Number of buffers allocated since start.
+    - ``by_dtype``: Bytes held by variables, grouped by dtype.
+
+    Example:
+
+      >>> import scipp as sc
+      >>> sc.reset_peak_memory()
+      >>> var = sc.zeros(dims=['x'], shape=[1000])
+      >>> sc.memory_stats()['peak_bytes'] >= 8000
+      True
+
+    :return: Dict with memory statistics.
+    """
+    return _cpp.memory_stats()
+
+
+def reset_peak_memory() -> None:
+    """Reset the peak memory reported by :py:func:`scipp.memory_stats` to the
+    current memory.
+    """
+    _cpp.reset_peak_memory()
+
+
+def memory_usage(x: VariableLike) -> Dict[str, int]:
+    """Return the memory of the buffers referenced by a variable, data array,
+    or dataset.
+
+    Buffers shared between several variables, e.g., coords shared between
+    items of a dataset, are counted only once. Slices keep the full buffer
+    alive, so the size of the full buffer is reported.
+
+    The returned dict contains:
+
+    - ``bytes``: Bytes of all referenced buffers.
+    - ``unused_bytes``: Bytes of bin buffers not referenced by any bin, e.g.,
+      after filtering events.
+
+    :param x: Input variable, data array, or dataset.
+    :return: Dict with memory usage.
+    """
+    return _cpp.memory_usage(x)
@@ -154,6 +154,30 @@ def rebin(x: VariableLike, dim: str, bins: _cpp.Variable) -> VariableLike:
     return _call_cpp_func(_cpp.rebin, x, dim, bins)
 
 
+def resample(x: VariableLike, dim: str, bins: _cpp.Variable,
+             mode: str = 'sum') -> VariableLike:
+    """
+    Resample a dimension of a data array or dataset.
+
+    The input must contain bin edges for the given dimension `dim`. Mode 'sum'
+    is equivalent to :py:func:`scipp.rebin`. The other modes treat the data as
+    piecewise constant within each bin: 'mean' computes the mean of the input
+    in each output bin, weighted by the overlap of input and output bins, and
+    'max' and 'min' select the extreme value of all input bins overlapping an
+    output bin. Output bins that do not overlap any input bin are NaN for
+    'mean'.
+
+    :param x: Data to resample.
+    :param dim: Dimension to resample over.
+    :param bins: New bin edges.
+    :param mode: One of 'sum', 'mean', 'max', and 'min'.
+    :raises: If data cannot be resampled, e.g., if the existing coordinate is not
+             a bin-edge coordinate.
+    :return: Data resampled according to the new bin edges.
+    """
+    return _call_cpp_func(_cpp.resample, x, dim, bins, mode)
+
+
 def where(condition: _cpp.Variable, x: _cpp.Variable,
           y: _cpp.Variable) -> _cpp.Variable:
     """Return elements chosen from x or y depending on condition.
@@ -0,0 +1,52 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+
+from contextlib import contextmanager
+
+from .._scipp import core as _cpp
+
+
+def get_num_threads() -> int:
+    """Return the maximum number of threads used by scipp operations.
+
+    :return: Maximum number of threads.
+    """
+    return _cpp.get_num_threads()
+
+
+def set_num_threads(n: int = None) -> None:
+    """Set the maximum number of threads used by scipp operations.
+
+    The limit applies to all subsequent operations in all Python threads.
+    By default scipp uses all available cores.
+
+    :param n: Maximum number of threads. If None, restore the default.
+    :raises: ValueError if ``n`` is less than 1.
+    """
+    if n is None:
+        _cpp.reset_num_threads()
+    else:
+        _cpp.set_num_threads(n)
+
+
+@contextmanager
+def num_threads(n: int):
+    """Context manager limiting the number of threads used by scipp operations.
+
+    The previous limit is restored on exit. If no limit was set before, the
+    default, i.e., all available cores, is restored.
+
+    Example:
+
+      >>> import scipp as sc
+      >>> with sc.num_threads(1):
+      ...     pass  # operations in this block run in a single thread
+
+    :param n: Maximum number of threads within the context.
+    """
+    previous = None if _cpp.num_threads_is_default() else get_num_threads()
+    set_num_threads(n)
+    try:
+        yield
+    finally:
+        set_num_threads(previous)
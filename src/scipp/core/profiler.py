@@ -0,0 +1,89 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+
+from contextlib import contextmanager
+from typing import Dict, List, Union
+
+from .._scipp import core as _cpp
+
+
+def enable_profiling(enabled: bool = True) -> None:
+    """Enable or disable recording of scipp operations.
+
+    While enabled, calls of element-wise operations and reductions are
+    recorded by name. Use :py:func:`scipp.profiling_stats` or
+    :py:func:`scipp.profiling_summary` to inspect the result.
+    Profiling adds a small overhead per call and is disabled by default.
+
+    :param enabled: Enable if True, disable if False.
+    """
+    _cpp.set_profiling_enabled(enabled)
+
+
+def reset_profiling() -> None:
+    """Clear all statistics and events recorded by the profiler.
+    """
+    _cpp.reset_profiling()
+
+
+def profiling_stats() -> List[Dict[str, Union[str, int, float]]]:
+    """Return statistics of recorded operations, sorted by decreasing time.
+
+    Each item is a dict with:
+
+    - ``name``: Name of the operation.
+    - ``calls``: Number of calls.
+    - ``seconds``: Total wall time, including nested operations.
+    - ``elements``: Number of elements processed.
+    - ``bytes_read``, ``bytes_written``: Estimated from element sizes, the
+      actual memory traffic depends on caching and broadcasting.
+    - ``max_threads``: Maximum number of distinct threads that ran work of any
+      single call.
+    - ``vectorized_chunks``, ``specialized_chunks``, ``generic_chunks``:
+      Number of chunks processed by the vectorized inner loop, by loops
+      specialized for common strides, and by the generic loop.
+
+    :return: List of dicts with statistics, one per operation name.
+    """
+    return _cpp.profiling_stats()
+
+
+def profiling_summary() -> str:
+    """Return a table of the statistics of recorded operations.
+
+    Example:
+
+      >>> import scipp as sc
+      >>> with sc.profile():
+      ...     var = sc.sin(sc.zeros(dims=['x'], shape=[1000], unit='rad'))
+      >>> print(sc.profiling_summary())  # doctest: +SKIP
+
+    :return: Human-readable table.
+    """
+    return _cpp.profiling_summary()
+
+
+def save_chrome_trace(filename: str) -> None:
+    """Save recorded calls in the Chrome trace-event format.
+
+    The file can be viewed in ``chrome://tracing`` or https://ui.perfetto.dev.
+
+    :param filename: Name of the output file.
+    """
+    with open(filename, 'w') as f:
+        f.write(_cpp.profiling_chrome_trace())
+
+
+@contextmanager
+def profile(reset: bool = True):
+    """Context manager enabling the profiler within its block.
+
+    :param reset: If True, clear previously recorded statistics first.
+    """
+    if reset:
+        reset_profiling()
+    enable_profiling(True)
+    try:
+        yield
+    finally:
+        enable_profiling(False)
@@ -192,6 +192,52 @@ def empty_like(var: _cpp.Variable) -> _cpp.Variable:
                  with_variances=var.variances is not None)
 
 
+def map_file(filename: str,
+             *,
+             dims: _Sequence[str] = None,
+             shape: _Sequence[int] = None,
+             sizes: dict = None,
+             unit: _Union[_cpp.Unit, str] = _cpp.units.dimensionless,
+             dtype: type(_cpp.dtype.float64) = _cpp.dtype.float64,
+             offset: int = 0,
+             variances_offset: _Optional[int] = None,
+             mode: str = 'r') -> _cpp.Variable:
+    """Constructs a :class:`Variable` with values stored in a memory-mapped
+    file.
+
+    The file must contain the elements as a raw array in native byte order,
+    in the order of the given dims. Elements are only read from the file
+    when accessed, so files larger than the available memory can be used,
+    e.g., by slicing before other operations or as the buffer of binned data.
+    Copies of the variable are held in memory.
+
+    :seealso: :py:func:`scipp.empty` :py:func:`scipp.array`
+
+    :param filename: Name of the file to map.
+    :param dims: Optional (if sizes is specified), dimension labels.
+    :param shape: Optional (if sizes is specified), dimension sizes.
+    :param sizes: Optional, dimension label to size map.
+    :param unit: Optional, unit of contents. Default=dimensionless
+    :param dtype: Optional, type of the elements in the file. Supported are
+      float64, float32, int64, int32, and bool. Default=float64
+    :param offset: Optional, byte offset of the values in the file. Default=0
+    :param variances_offset: Optional, byte offset of the variances in the
+      file. Default=None, i.e., no variances.
+    :param mode: Optional, ``'r'`` for a read-only variable or ``'c'`` for
+      copy-on-write, where modifications are not written to the file.
+      Default='r'
+    """
+    if mode not in ('r', 'c'):
+        raise ValueError(f"Expected mode 'r' or 'c', got '{mode}'.")
+    return _cpp.map_file(filename,
+                         **_parse_dims_shape_sizes(dims, shape, sizes),
+                         unit=unit,
+                         dtype=dtype,
+                         offset=offset,
+                         variances_offset=variances_offset,
+                         copy_on_write=mode == 'c')
+
+
 def full(*,
          dims: _Sequence[str] = None,
          shape: _Sequence[int] = None,
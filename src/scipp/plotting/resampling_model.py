@@ -5,8 +5,8 @@
 from enum import Enum
 
 from ..core import bin as bin_
-from ..core import dtype, units
-from ..core import linspace, rebin, get_slice_params, concat, histogram
+from ..core import dtype
+from ..core import linspace, resample, get_slice_params, concat, histogram
 from ..core import DataArray, DimensionError
 from .tools import to_bin_edges
 
@@ -17,30 +17,7 @@ class ResamplingMode(Enum):
 
 
 def _resample(array, mode: ResamplingMode, dim, edges):
-    if mode == ResamplingMode.sum:
-        return rebin(array, dim, edges)
-    if array.dtype == dtype.float64:
-        array = array.copy()
-    else:
-        array = array.astype(dtype.float64)
-    # Scale by bin widths, so `rebin` is effectively performing a "mean"
-    # operation instead of "sum".
-    # TODO
-    # Note that it is inefficient to do this repeatedly. Rather than working
-    # around that here we should look into supporting an alternative to
-    # `rebin` that works on non-counts data
-    coord = array.coords[dim]
-    width = coord[dim, 1:] - coord[dim, :-1]
-    width.unit = units.one
-    array.data *= width
-    unit = array.unit
-    array.unit = units.counts
-    array = rebin(array, dim, edges)
-    width = edges[dim, 1:] - edges[dim, :-1]
-    width.unit = units.one
-    array /= width
-    array.unit = unit
-    return array
+    return resample(array, dim, edges, mode.name)
 
 
 class ResamplingModel():
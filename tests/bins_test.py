@@ -297,3 +297,47 @@ def test_bins_like():
     with pytest.raises(sc.NotFoundError):
         dense = dense.rename_dims({'x': 'y'})
         sc.bins_like(binned, dense),
+
+
+def test_bins_reserve():
+    data = sc.array(dims=['row'], values=[1, 2, 3, 4])
+    begin = sc.array(dims=['x'], values=[0, 3], dtype=sc.dtype.int64)
+    end = sc.array(dims=['x'], values=[3, 4], dtype=sc.dtype.int64)
+    binned = sc.bins(begin=begin, end=end, dim='row', data=data)
+    original = binned.copy()
+    binned.bins.reserve(sc.scalar(10))
+    assert sc.identical(binned, original)
+    expected = original.bins.concatenate(original)
+    binned.bins.concatenate(original, out=binned)
+    assert sc.identical(binned, expected)
+
+
+def test_bins_reserve_data_array():
+    data = sc.array(dims=['row'], values=[1, 2, 3, 4])
+    begin = sc.array(dims=['x'], values=[0, 3], dtype=sc.dtype.int64)
+    end = sc.array(dims=['x'], values=[3, 4], dtype=sc.dtype.int64)
+    buffer = sc.DataArray(data=data, coords={'row': data})
+    binned = sc.DataArray(data=sc.bins(begin=begin, end=end, dim='row', data=buffer))
+    original = binned.copy()
+    binned.bins.reserve(sc.array(dims=['x'], values=[2, 8]))
+    assert sc.identical(binned, original)
+    expected = original.bins.concatenate(original)
+    binned.bins.concatenate(original, out=binned)
+    assert sc.identical(binned, expected)
+
+
+def test_histogram_multiple_edges_matches_bin_and_sum():
+    x = sc.array(dims=['row'], values=np.random.rand(1000), unit='m')
+    y = sc.array(dims=['row'], values=np.random.rand(1000), unit='m')
+    table = sc.DataArray(sc.ones(sizes={'row': 1000}, unit='counts'),
+                         coords={
+                             'x': x,
+                             'y': y
+                         })
+    edges = [
+        sc.linspace(dim='x', start=0.0, stop=1.0, num=5, unit='m'),
+        sc.array(dims=['y'], values=[0.0, 0.1, 0.5, 1.0], unit='m')
+    ]
+    hist = sc.histogram(table, bins=edges)
+    assert hist.dims == ['x', 'y']
+    assert sc.identical(hist, sc.bin(table, edges=edges).bins.sum())
@@ -280,3 +280,44 @@ def test_sizes():
     assert a.sizes == {'x': 2}
     a = sc.DataArray(data=sc.Variable(dims=['x', 'z'], values=np.ones((2, 4))))
     assert a.sizes == {'x': 2, 'z': 4}
+
+
+def _make_resample_input():
+    return sc.DataArray(
+        data=sc.array(dims=['x'], values=[1.0, 4.0, 2.0, 3.0], unit=sc.units.K),
+        coords={'x': sc.array(dims=['x'], values=[0.0, 1.0, 2.0, 3.0, 4.0])})
+
+
+def _check_resample(mode, expected):
+    a = _make_resample_input()
+    edges = sc.array(dims=['x'], values=[0.0, 1.5, 4.0])
+    resampled = sc.resample(a, 'x', edges, mode)
+    assert resampled.unit == sc.units.K
+    assert sc.identical(resampled.coords['x'], edges)
+    np.testing.assert_allclose(resampled.values, expected)
+
+
+def test_resample_sum():
+    _check_resample('sum', [1.0 + 0.5 * 4.0, 0.5 * 4.0 + 2.0 + 3.0])
+    a = _make_resample_input()
+    edges = sc.array(dims=['x'], values=[0.0, 1.5, 4.0])
+    assert sc.identical(sc.resample(a, 'x', edges), sc.rebin(a, 'x', edges))
+
+
+def test_resample_mean():
+    _check_resample('mean', [(1.0 + 0.5 * 4.0) / 1.5, (0.5 * 4.0 + 2.0 + 3.0) / 2.5])
+
+
+def test_resample_max():
+    _check_resample('max', [4.0, 4.0])
+
+
+def test_resample_min():
+    _check_resample('min', [1.0, 2.0])
+
+
+def test_resample_invalid_mode():
+    a = _make_resample_input()
+    edges = sc.array(dims=['x'], values=[0.0, 1.5, 4.0])
+    with pytest.raises(ValueError):
+        sc.resample(a, 'x', edges, 'median')
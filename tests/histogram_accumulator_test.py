@@ -0,0 +1,60 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+from concurrent.futures import ThreadPoolExecutor
+
+import pytest
+
+import scipp as sc
+
+
+def _chunk(offset):
+    x = sc.array(dims=['event'], values=[0.1 * offset, 1.5, 2.5, 10.0], unit='m')
+    return sc.DataArray(sc.ones(sizes={'event': 4}, unit='counts'), coords={'x': x})
+
+
+def _edges():
+    return sc.array(dims=['x'], values=[0.0, 1.0, 2.0, 3.0], unit='m')
+
+
+def test_snapshot_without_chunks_raises():
+    accumulator = sc.HistogramAccumulator(_edges())
+    assert accumulator.chunks == 0
+    with pytest.raises(RuntimeError):
+        accumulator.snapshot()
+
+
+def test_add_matches_histogram_of_chunks():
+    accumulator = sc.HistogramAccumulator(_edges())
+    accumulator.add(_chunk(0))
+    accumulator.add(_chunk(1))
+    expected = sc.histogram(_chunk(0), bins=_edges())
+    expected.data += sc.histogram(_chunk(1), bins=_edges()).data
+    assert sc.identical(accumulator.snapshot(), expected)
+    assert accumulator.chunks == 2
+    assert sc.identical(accumulator.bins, _edges())
+
+
+def test_snapshot_is_not_modified_by_later_chunks():
+    accumulator = sc.HistogramAccumulator(_edges())
+    accumulator.add(_chunk(0))
+    snapshot = accumulator.snapshot()
+    accumulator.add(_chunk(0))
+    assert sc.identical(snapshot, sc.histogram(_chunk(0), bins=_edges()))
+
+
+def test_concurrent_add():
+    accumulator = sc.HistogramAccumulator(_edges())
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        list(executor.map(lambda i: accumulator.add(_chunk(i % 3)), range(30)))
+    assert accumulator.chunks == 30
+    expected = sc.histogram(_chunk(0), bins=_edges()).data
+    expected += sc.histogram(_chunk(1), bins=_edges()).data
+    expected += sc.histogram(_chunk(2), bins=_edges()).data
+    assert sc.identical(accumulator.snapshot().data, 10.0 * expected)
+
+
+def test_reset():
+    accumulator = sc.HistogramAccumulator(_edges())
+    accumulator.add(_chunk(0))
+    accumulator.reset()
+    assert accumulator.chunks == 0
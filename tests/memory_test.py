@@ -0,0 +1,44 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+import scipp as sc
+
+
+def test_memory_stats_tracks_allocation():
+    before = sc.memory_stats()
+    var = sc.zeros(dims=['x'], shape=[1000], dtype='float64')
+    stats = sc.memory_stats()
+    assert stats['current_bytes'] >= before['current_bytes'] + 8000
+    assert stats['allocations'] > before['allocations']
+    assert stats['by_dtype']['float64'] >= 8000
+    del var
+
+
+def test_reset_peak_memory():
+    var = sc.zeros(dims=['x'], shape=[1000])
+    del var
+    sc.reset_peak_memory()
+    stats = sc.memory_stats()
+    assert stats['peak_bytes'] == stats['current_bytes']
+
+
+def test_memory_usage_variable():
+    var = sc.zeros(dims=['x'], shape=[4], with_variances=True)
+    assert sc.memory_usage(var) == {'bytes': 64, 'unused_bytes': 0}
+    assert sc.memory_usage(var['x', 1:2])['bytes'] == 64
+
+
+def test_memory_usage_shared_coord_counted_once():
+    var = sc.zeros(dims=['x'], shape=[4])
+    da = sc.DataArray(data=var, coords={'x': var})
+    assert sc.memory_usage(da)['bytes'] == 32
+    ds = sc.Dataset(data={'a': da, 'b': da})
+    assert sc.memory_usage(ds)['bytes'] == 32
+
+
+def test_memory_usage_binned_unused():
+    table = sc.data.table_xyz(100)
+    binned = table.bin(x=4)
+    assert sc.memory_usage(binned)['unused_bytes'] == 0
+    c = binned.bins.constituents
+    empty = sc.bins(data=c['data'], begin=c['begin'], end=c['begin'], dim=c['dim'])
+    assert sc.memory_usage(empty)['unused_bytes'] > 0
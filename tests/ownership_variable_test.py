@@ -274,6 +274,51 @@ def test_own_var_1d_copy():
     assert sc.identical(v_methdeepcopy, original)
 
 
+def test_own_var_1d_copy_after_get():
+    # Arrays returned by .values before a deep copy do not write to the copy.
+    v = make_variable(np.arange(5.0), variances=np.arange(5.0))
+    a = v.values
+    b = v.variances
+    v_deepcopy = deepcopy(v)
+    a[0] = -1.0
+    b[0] = -1.0
+    assert sc.identical(v, make_variable([-1.0, 1.0, 2.0, 3.0, 4.0],
+                                         variances=[-1.0, 1.0, 2.0, 3.0, 4.0]))
+    assert sc.identical(v_deepcopy, make_variable(np.arange(5.0),
+                                                  variances=np.arange(5.0)))
+
+
+def test_own_var_1d_readonly_get():
+    # Read-only arrays refer to the buffer of the variable.
+    v = make_variable(np.arange(5.0))
+    a = sc.broadcast(v, dims=['y', 'x'], shape=[2, 5]).values
+    assert not a.flags['WRITEABLE']
+    v['x', 0] = sc.scalar(-1.0)
+    np.testing.assert_array_equal(a[0], [-1.0, 1.0, 2.0, 3.0, 4.0])
+
+
+def test_own_var_1d_readonly_get_after_copy():
+    # Read-only arrays keep the buffer shared with the copy alive, which is
+    # not written to.
+    v = make_variable(np.arange(5.0))
+    v_deepcopy = deepcopy(v)
+    a = sc.broadcast(v, dims=['y', 'x'], shape=[2, 5]).values
+    assert not a.flags['WRITEABLE']
+    v['x', 0] = sc.scalar(-1.0)
+    del v_deepcopy
+    np.testing.assert_array_equal(a[0], np.arange(5.0))
+
+
+def test_own_var_1d_copy_after_readonly_get():
+    v = make_variable(np.arange(5.0))
+    a = sc.broadcast(v, dims=['y', 'x'], shape=[2, 5]).values
+    v_deepcopy = deepcopy(v)
+    v['x', 0] = sc.scalar(-1.0)
+    del v_deepcopy
+    np.testing.assert_array_equal(a[0], np.arange(5.0))
+    assert sc.identical(v, make_variable([-1.0, 1.0, 2.0, 3.0, 4.0]))
+
+
 def test_own_var_1d_pyobj_set():
     # Input data is deep-copied.
     x = {'num': 1, 'list': [2, 3]}
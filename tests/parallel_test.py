@@ -0,0 +1,34 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+import numpy as np
+import pytest
+
+import scipp as sc
+
+
+def test_set_num_threads():
+    sc.set_num_threads(1)
+    assert sc.get_num_threads() == 1
+    sc.set_num_threads()
+    assert sc.get_num_threads() >= 1
+
+
+def test_set_num_threads_invalid():
+    with pytest.raises(ValueError):
+        sc.set_num_threads(0)
+
+
+def test_num_threads_context_manager_restores_previous():
+    previous = sc.get_num_threads()
+    var = sc.array(dims=['x'], values=np.arange(100000.0))
+    with sc.num_threads(1):
+        assert sc.get_num_threads() == 1
+        assert sc.identical(var + var, 2.0 * var)
+    assert sc.get_num_threads() == previous
+
+
+def test_num_threads_context_manager_restores_default():
+    sc.set_num_threads()
+    with sc.num_threads(1):
+        pass
+    assert sc._scipp.core.num_threads_is_default()
@@ -0,0 +1,39 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2021 Scipp contributors (https://github.com/scipp)
+import json
+
+import scipp as sc
+
+
+def _sin():
+    return sc.sin(sc.zeros(dims=['x'], shape=[100], unit='rad'))
+
+
+def test_disabled_by_default_records_nothing():
+    sc.reset_profiling()
+    _sin()
+    assert sc.profiling_stats() == []
+
+
+def test_profile_records_named_operation():
+    with sc.profile():
+        _sin()
+    stats = {op['name']: op for op in sc.profiling_stats()}
+    assert 'sin' in stats
+    assert stats['sin']['calls'] == 1
+    assert stats['sin']['elements'] == 100
+    assert stats['sin']['bytes_written'] == 800
+    assert 'sin' in sc.profiling_summary()
+    sc.reset_profiling()
+    assert sc.profiling_stats() == []
+
+
+def test_save_chrome_trace(tmp_path):
+    with sc.profile():
+        _sin()
+    filename = str(tmp_path / 'trace.json')
+    sc.save_chrome_trace(filename)
+    with open(filename) as f:
+        trace = json.load(f)
+    assert 'sin' in [event['name'] for event in trace['traceEvents']]
+    sc.reset_profiling()
@@ -372,3 +372,52 @@ def test_empty_sizes():
                         sc.empty(sizes=dict(zip(dims, shape))))
     with pytest.raises(ValueError):
         sc.empty(dims=dims, shape=shape, sizes=dict(zip(dims, shape)))
+
+
+def test_map_file(tmp_path):
+    filename = str(tmp_path / 'values.bin')
+    values = np.arange(6.0)
+    variances = values / 10
+    np.concatenate([values, variances]).tofile(filename)
+    var = sc.map_file(filename,
+                      dims=['y', 'x'],
+                      shape=[2, 3],
+                      unit='m',
+                      variances_offset=values.nbytes)
+    assert sc.identical(
+        var,
+        sc.array(dims=['y', 'x'],
+                 values=values.reshape(2, 3),
+                 variances=variances.reshape(2, 3),
+                 unit='m'))
+    assert sc.identical(var['y', 1].sum(), (var.copy()['y', 1]).sum())
+
+
+def test_map_file_read_only(tmp_path):
+    filename = str(tmp_path / 'values.bin')
+    np.arange(4, dtype=np.int32).tofile(filename)
+    var = sc.map_file(filename, sizes={'x': 4}, dtype='int32')
+    with pytest.raises(sc.VariableError):
+        var *= 2
+    copied = var.copy()
+    copied *= 2
+    assert sc.identical(var,
+                        sc.array(dims=['x'], values=np.arange(4, dtype=np.int32)))
+
+
+def test_map_file_copy_on_write(tmp_path):
+    filename = str(tmp_path / 'values.bin')
+    np.arange(4.0).tofile(filename)
+    var = sc.map_file(filename, dims=['x'], shape=[4], mode='c')
+    var *= 2.0
+    assert sc.identical(var, sc.array(dims=['x'], values=2 * np.arange(4.0)))
+    assert np.array_equal(np.fromfile(filename), np.arange(4.0))
+
+
+def test_map_file_exceeding_file_size_raises(tmp_path):
+    filename = str(tmp_path / 'values.bin')
+    np.arange(4.0).tofile(filename)
+    with pytest.raises(IndexError):
+        sc.map_file(filename, dims=['x'], shape=[5])
+    with pytest.raises(ValueError):
+        sc.map_file(filename, dims=['x'], shape=[4], mode='w')